@@ -518,6 +518,10 @@ uint64_t OS::get_static_memory_peak_usage() const {
 	return ::OS::get_singleton()->get_static_memory_peak_usage();
 }
 
+Dictionary OS::get_static_memory_usage_by_tag() const {
+	return ::OS::get_singleton()->get_static_memory_usage_by_tag();
+}
+
 Dictionary OS::get_memory_info() const {
 	return ::OS::get_singleton()->get_memory_info();
 }
@@ -702,6 +706,7 @@ void OS::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_static_memory_usage"), &OS::get_static_memory_usage);
 	ClassDB::bind_method(D_METHOD("get_static_memory_peak_usage"), &OS::get_static_memory_peak_usage);
+	ClassDB::bind_method(D_METHOD("get_static_memory_usage_by_tag"), &OS::get_static_memory_usage_by_tag);
 	ClassDB::bind_method(D_METHOD("get_memory_info"), &OS::get_memory_info);
 
 	ClassDB::bind_method(D_METHOD("move_to_trash", "path"), &OS::move_to_trash);
@@ -230,6 +230,7 @@ public:
 
 	uint64_t get_static_memory_usage() const;
 	uint64_t get_static_memory_peak_usage() const;
+	Dictionary get_static_memory_usage_by_tag() const;
 	Dictionary get_memory_info() const;
 
 	void delay_usec(int p_usec) const;
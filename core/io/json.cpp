@@ -317,10 +317,16 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						str += res;
 
 					} else {
-						if (p_str[index] == '\n') {
-							line++;
+						// Append the whole run of plain characters at once.
+						const int from = index;
+						while (p_str[index] != 0 && p_str[index] != '"' && p_str[index] != '\\') {
+							if (p_str[index] == '\n') {
+								line++;
+							}
+							index++;
 						}
-						str += p_str[index];
+						str += StrRange(p_str + from, index - from);
+						continue;
 					}
 					index++;
 				}
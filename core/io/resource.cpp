@@ -259,13 +259,14 @@ void Resource::_dupe_sub_resources(Variant &r_variant, Node *p_for_scene, HashMa
 					// Replace in dictionary key.
 					Ref<Resource> sr = k;
 					if (sr.is_valid() && sr->is_local_to_scene()) {
+						Variant value = d[k];
 						if (p_remap_cache.has(sr)) {
-							d[p_remap_cache[sr]] = d[k];
 							d.erase(k);
+							d[p_remap_cache[sr]] = value;
 						} else {
 							Ref<Resource> dupe = sr->duplicate_for_local_scene(p_for_scene, p_remap_cache);
-							d[dupe] = d[k];
 							d.erase(k);
+							d[dupe] = value;
 							p_remap_cache[sr] = dupe;
 						}
 					}
@@ -88,6 +88,15 @@ public:
 		tree.params_set_pairing_expansion(p_value);
 	}
 
+	// Trees in the mask are expected to change rarely, e.g. static geometry.
+	// They are only refit and optimized after items have been added or removed,
+	// reinserting at most p_optimize_budget items per update, and new items
+	// are paired on the next update rather than immediately.
+	void params_set_lazy_trees(uint32_t p_tree_mask, uint32_t p_optimize_budget = 64) {
+		BVH_LOCKED_FUNCTION
+		tree.params_set_lazy_trees(p_tree_mask, p_optimize_budget);
+	}
+
 	void set_pair_callback(PairCallback p_callback, void *p_userdata) {
 		BVH_LOCKED_FUNCTION
 		pair_callback = p_callback;
@@ -124,7 +133,12 @@ public:
 			// force a collision check no matter the AABB
 			if (p_active) {
 				_add_changed_item(h, p_aabb, false);
-				_check_for_collisions(true);
+
+				// items added to lazy trees (e.g. a streamed in chunk of static geometry)
+				// are paired together in one pass on the next update
+				if (!(tree._lazy_tree_mask & (1 << p_tree_id))) {
+					_check_for_collisions(true);
+				}
 			}
 		}
 
@@ -181,6 +181,9 @@ public:
 	BVH_Tree() {
 		for (int n = 0; n < NUM_TREES; n++) {
 			_root_node_id[n] = BVHCommon::INVALID;
+			_current_active_ref[n] = 0;
+			_tree_dirty[n] = false;
+			_lazy_optimize_pending[n] = 0;
 		}
 
 		// disallow zero leaf ids
@@ -364,6 +367,7 @@ private:
 			// we defer the refit updates until the update function is called once per frame
 			if (refit) {
 				leaf.set_dirty(true);
+				_tree_dirty[p_tree_id] = true;
 			}
 		} else {
 			// remove node if empty
@@ -68,6 +68,10 @@ uint32_t CallableCustomMethodPointerBase::hash() const {
 	return h;
 }
 
+bool CallableCustomMethodPointerBase::is_method_pointer(const CallableCustom *p_custom) {
+	return p_custom->get_compare_equal_func() == compare_equal;
+}
+
 void CallableCustomMethodPointerBase::_setup(uint32_t *p_base_ptr, uint32_t p_ptr_size) {
 	comp_ptr = p_base_ptr;
 	comp_size = p_ptr_size / 4;
@@ -77,6 +77,9 @@ public:
 	virtual CompareLessFunc get_compare_less_func() const;
 
 	virtual uint32_t hash() const;
+
+	// Method pointers can be called directly whenever their object is alive.
+	static bool is_method_pointer(const CallableCustom *p_custom);
 };
 
 template <typename T, typename R, typename... P>
@@ -1047,6 +1047,50 @@ MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_n
 	return nullptr;
 }
 
+// Must be a power of two.
+static constexpr uint32_t METHOD_CACHE_SIZE = 256;
+
+// Bumped to flush the method caches of all threads. Starts at 1 so empty entries never match.
+static SafeNumeric<uint32_t> method_cache_version(1);
+static thread_local ClassDB::MethodCacheEntry method_cache[METHOD_CACHE_SIZE];
+
+static _FORCE_INLINE_ void _invalidate_method_cache() {
+	method_cache_version.increment();
+}
+
+const ClassDB::MethodCacheEntry *ClassDB::get_method_cached(const StringName &p_class, const StringName &p_name) {
+	const uint32_t version = method_cache_version.get();
+	MethodCacheEntry &entry = method_cache[(p_class.hash() ^ (p_name.hash() * 31)) & (METHOD_CACHE_SIZE - 1)];
+	// The names are compared by pointer. They stay alive while the entry is valid, as the class holds its name and the method bind holds the method name.
+	if (likely(entry.version == version && entry.class_name == p_class.data_unique_pointer() && entry.method == p_name.data_unique_pointer())) {
+		return &entry;
+	}
+
+	MethodBind *method = get_method(p_class, p_name);
+	if (!method) {
+		return nullptr; // Misses are not cached, so names that are not kept alive by ClassDB are never stored.
+	}
+
+	entry.class_name = p_class.data_unique_pointer();
+	entry.method = p_name.data_unique_pointer();
+	entry.method_bind = method;
+	entry.version = version;
+	entry.can_validate = !method->is_vararg();
+	for (int i = 0; i < method->get_argument_count() && entry.can_validate; i++) {
+		switch (method->get_argument_type(i)) {
+			case Variant::NIL: // Variant arguments are not converted by ptrcall based validated calls of extensions.
+			case Variant::OBJECT: // The class of objects is not checked.
+			case Variant::ARRAY: // Neither is the type of typed arrays and dictionaries.
+			case Variant::DICTIONARY:
+				entry.can_validate = false;
+				break;
+			default:
+				break;
+		}
+	}
+	return &entry;
+}
+
 Vector<uint32_t> ClassDB::get_method_compatibility_hashes(const StringName &p_class, const StringName &p_name) {
 	OBJTYPE_RLOCK;
 
@@ -1883,6 +1927,7 @@ void ClassDB::_bind_method_custom(const StringName &p_class, MethodBind *p_metho
 #endif
 
 	type->method_map[p_method->get_name()] = p_method;
+	_invalidate_method_cache();
 }
 
 MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p_name, const Vector<Variant> &p_default_args, bool p_compatibility) {
@@ -1909,6 +1954,7 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 		ERR_FAIL_V_MSG(nullptr, vformat("Method already bound: '%s::%s'.", instance_type, p_name));
 	}
 	type->method_map[p_name] = bind;
+	_invalidate_method_cache();
 #ifdef DEBUG_METHODS_ENABLED
 	// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 	//bind->set_return_type("Variant");
@@ -1967,6 +2013,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 		_bind_compatibility(type, p_bind);
 	} else {
 		type->method_map[mdname] = p_bind;
+		_invalidate_method_cache();
 	}
 
 	Vector<Variant> defvals;
@@ -2253,6 +2300,7 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 #endif
 
 	classes[p_extension->class_name] = c;
+	_invalidate_method_cache();
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_method_binds) {
@@ -2264,6 +2312,7 @@ void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_
 		}
 	}
 	classes.erase(p_class);
+	_invalidate_method_cache();
 	default_values_cached.erase(p_class);
 	default_values.erase(p_class);
 #ifdef TOOLS_ENABLED
@@ -2319,6 +2368,7 @@ void ClassDB::cleanup() {
 	}
 
 	classes.clear();
+	_invalidate_method_cache();
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
@@ -105,7 +105,7 @@ public:
 
 		ObjectGDExtension *gdextension = nullptr;
 
-		HashMap<StringName, MethodBind *> method_map;
+		SwissHashMap<StringName, MethodBind *> method_map;
 		HashMap<StringName, LocalVector<MethodBind *>> method_map_compatibility;
 		HashMap<StringName, int64_t> constant_map;
 		struct EnumInfo {
@@ -451,6 +451,30 @@ public:
 	static MethodBind *get_method_with_compatibility(const StringName &p_class, const StringName &p_name, uint64_t p_hash, bool *r_method_exists = nullptr, bool *r_is_deprecated = nullptr);
 	static Vector<uint32_t> get_method_compatibility_hashes(const StringName &p_class, const StringName &p_name);
 
+	// Result of get_method(), cached per thread by class and method name.
+	// The cache is flushed whenever methods or extension classes are registered or unregistered.
+	struct MethodCacheEntry {
+		const void *class_name = nullptr;
+		const void *method = nullptr;
+		MethodBind *method_bind = nullptr;
+		uint32_t version = 0;
+		bool can_validate = false; // Method is not vararg and takes only arguments that validated_call() can handle.
+
+		// Whether the arguments match the method exactly, so they can be passed to validated_call() as they are.
+		_FORCE_INLINE_ bool can_call_validated(const Variant **p_args, int p_argcount) const {
+			if (!can_validate || p_argcount != method_bind->get_argument_count()) {
+				return false;
+			}
+			for (int i = 0; i < p_argcount; i++) {
+				if (p_args[i]->get_type() != method_bind->get_argument_type(i)) {
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+	static const MethodCacheEntry *get_method_cached(const StringName &p_class, const StringName &p_name);
+
 	static void add_virtual_method(const StringName &p_class, const MethodInfo &p_method, bool p_virtual = true, const Vector<String> &p_arg_names = Vector<String>(), bool p_object_core = false);
 	static void get_virtual_methods(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance = false);
 	static void add_extension_class_virtual_method(const StringName &p_class, const GDExtensionClassVirtualMethodInfo *p_method_info);
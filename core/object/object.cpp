@@ -32,6 +32,7 @@
 
 #include "core/extension/gdextension_manager.h"
 #include "core/io/resource.h"
+#include "core/object/callable_method_pointer.h"
 #include "core/object/class_db.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
@@ -40,6 +41,7 @@
 #include "core/string/translation_server.h"
 #include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
+#include "core/variant/variant_internal.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -807,10 +809,19 @@ Variant Object::callp(const StringName &p_method, const Variant **p_args, int p_
 
 	//extension does not need this, because all methods are registered in MethodBind
 
-	MethodBind *method = ClassDB::get_method(get_class_name(), p_method);
+	const ClassDB::MethodCacheEntry *cached = ClassDB::get_method_cached(get_class_name(), p_method);
 
-	if (method) {
-		ret = method->call(this, p_args, p_argcount, r_error);
+	if (cached) {
+		MethodBind *method = cached->method_bind;
+		if (cached->can_call_validated(p_args, p_argcount)) {
+			// Arguments already have the right types, skip the checks and conversions of call().
+			// A script instance may have left an error when it did not have the method.
+			r_error.error = Callable::CallError::CALL_OK;
+			VariantInternal::initialize(&ret, method->get_argument_type(-1));
+			method->validated_call(this, p_args, &ret);
+		} else {
+			ret = method->call(this, p_args, p_argcount, r_error);
+		}
 	} else {
 		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
 	}
@@ -1148,30 +1159,23 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
 	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
-	}
-
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	// will not affect the signal calling. This only takes a reference,
+	// any change to the connections from now on copies the array.
+	const Vector<SignalData::EmitSlot> emit_slots = s->emit_slots;
+	const SignalData::EmitSlot *slots = emit_slots.ptr();
+	const uint32_t slot_count = emit_slots.size();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		bool disconnect = !slots[i].removed && (slots[i].flags & CONNECT_ONE_SHOT);
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (slots[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 			disconnect = false;
 		}
 #endif
 		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			_disconnect(p_name, slots[i].callable);
 		}
 	}
 
@@ -1180,10 +1184,15 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Error err = OK;
 
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const SignalData::EmitSlot &slot = slots[i];
+		const Callable &callable = slot.callable;
+		const uint32_t &flags = slot.flags;
+
+		if (slot.removed) {
+			continue; // Disconnected before this emission started.
+		}
 
-		if (!callable.is_valid()) {
+		if (slot.object_id.is_valid() && !ObjectDB::get_instance(slot.object_id)) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
@@ -1192,15 +1201,27 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		int argc = p_argcount;
 
 		if (flags & CONNECT_DEFERRED) {
+			if (!callable.is_valid()) {
+				continue;
+			}
 			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
 			Variant ret;
-			callable.callp(args, argc, ret, ce);
+			if (slot.method_pointer) {
+				// The object is alive, which is all a method pointer needs.
+				callable.get_custom()->call(args, argc, ret, ce);
+			} else {
+				callable.callp(args, argc, ret, ce);
+			}
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
+				if (!callable.is_valid()) {
+					// Checked after the call rather than before, as it's slow for standard callables. Invalid targets are skipped silently.
+					continue;
+				}
 #ifdef DEBUG_ENABLED
 				if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
 					continue;
@@ -1217,10 +1238,6 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
 	return err;
 }
 
@@ -1433,11 +1450,54 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 	}
 
 	//use callable version as key, so binds can be ignored
-	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	SignalData::Slot &added = s->slot_map.insert(*p_callable.get_base_comparator(), slot)->value;
+	s->add_emit_slot(added);
 
 	return OK;
 }
 
+void Object::SignalData::add_emit_slot(Slot &p_slot) {
+	EmitSlot emit_slot;
+	emit_slot.callable = p_slot.conn.callable;
+	emit_slot.flags = p_slot.conn.flags;
+	if (emit_slot.callable.is_custom()) {
+		const CallableCustom *custom = emit_slot.callable.get_custom();
+		emit_slot.method_pointer = CallableCustomMethodPointerBase::is_method_pointer(custom);
+		emit_slot.object_id = custom->get_object();
+	} else {
+		emit_slot.object_id = emit_slot.callable.get_object_id();
+	}
+
+	p_slot.emit_index = emit_slots.size();
+	emit_slots.push_back(emit_slot);
+}
+
+void Object::SignalData::remove_emit_slot(uint32_t p_index) {
+	// Keep the order by leaving a hole, instead of moving the following slots.
+	EmitSlot &emit_slot = emit_slots.write[p_index];
+	emit_slot.callable = Callable();
+	emit_slot.removed = true;
+	emit_removed++;
+
+	if (emit_removed * 2 <= (uint32_t)emit_slots.size()) {
+		return;
+	}
+
+	// Mostly holes, compact. The slot map has the same order as the emit slots.
+	Vector<EmitSlot> compacted;
+	compacted.resize(slot_map.size());
+	EmitSlot *compacted_ptr = compacted.ptrw();
+	const EmitSlot *emit_ptr = emit_slots.ptr();
+	uint32_t index = 0;
+	for (KeyValue<Callable, Slot> &E : slot_map) {
+		compacted_ptr[index] = emit_ptr[E.value.emit_index];
+		E.value.emit_index = index;
+		index++;
+	}
+	emit_slots = compacted;
+	emit_removed = 0;
+}
+
 bool Object::is_connected(const StringName &p_signal, const Callable &p_callable) const {
 	ERR_FAIL_COND_V_MSG(p_callable.is_null(), false, vformat("Cannot determine if connected to '%s': the provided callable is null.", p_signal)); // Should use `is_null`, see note in `connect` about the use of `is_valid`.
 	const SignalData *s = signal_map.getptr(p_signal);
@@ -1508,7 +1568,9 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 		}
 	}
 
+	const uint32_t emit_index = slot->emit_index;
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->remove_emit_slot(emit_index);
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
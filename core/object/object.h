@@ -41,6 +41,7 @@
 #include "core/templates/list.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/swiss_hash_map.h"
 #include "core/variant/callable_bind.h"
 #include "core/variant/variant.h"
 
@@ -603,14 +604,30 @@ private:
 			int reference_count = 0;
 			Connection conn;
 			List<Connection>::Element *cE = nullptr;
+			uint32_t emit_index = 0;
+		};
+
+		// Flat copy of the connections in connection order, iterated when emitting.
+		// Emission only takes a reference to it, so connecting or disconnecting while emitting copies it instead.
+		struct EmitSlot {
+			Callable callable;
+			ObjectID object_id;
+			uint32_t flags = 0;
+			bool method_pointer = false;
+			bool removed = false;
 		};
 
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		Vector<EmitSlot> emit_slots;
+		uint32_t emit_removed = 0;
 		bool removable = false;
+
+		void add_emit_slot(Slot &p_slot);
+		void remove_emit_slot(uint32_t p_index);
 	};
 
-	HashMap<StringName, SignalData> signal_map;
+	SwissHashMap<StringName, SignalData> signal_map;
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
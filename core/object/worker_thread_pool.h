@@ -266,6 +266,14 @@ public:
 #endif
 	}
 
+	_FORCE_INLINE_ int get_low_priority_thread_count() const {
+#ifdef THREADS_ENABLED
+		return max_low_priority_threads;
+#else
+		return 1;
+#endif
+	}
+
 	static WorkerThreadPool *get_singleton() { return singleton; }
 	static int get_thread_index();
 	static TaskID get_caller_task_id();
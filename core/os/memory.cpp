@@ -31,8 +31,10 @@
 #include "memory.h"
 
 #include "core/error/error_macros.h"
+#include "core/os/mutex.h"
 #include "core/templates/safe_refcount.h"
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -59,15 +61,30 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 }
 #endif
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_TAGS_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+SafeNumeric<uint64_t> Memory::tag_usage[TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_max_usage[TAG_MAX];
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
+thread_local Memory::Tag Memory::current_tag = Memory::TAG_GENERAL;
+
+// The size header of padded allocations stores the tag in its top byte.
+static constexpr int TAG_SHIFT = 56;
+static constexpr uint64_t SIZE_MASK = (uint64_t(1) << TAG_SHIFT) - 1;
+
 inline bool is_power_of_2(size_t x) { return x && ((x & (x - 1U)) == 0U); }
 
+#ifdef MEMORY_TAGS_ENABLED
+static _FORCE_INLINE_ void _add_usage(SafeNumeric<uint64_t> &r_usage, SafeNumeric<uint64_t> &r_max_usage, uint64_t p_bytes) {
+	uint64_t new_usage = r_usage.add(p_bytes);
+	r_max_usage.exchange_if_greater(new_usage);
+}
+#endif
+
 void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
 	DEV_ASSERT(is_power_of_2(p_alignment));
 
@@ -98,8 +115,8 @@ void Memory::free_aligned_static(void *p_memory) {
 	free(p);
 }
 
-void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
-#ifdef DEBUG_ENABLED
+void *Memory::_alloc_static(size_t p_bytes, bool p_pad_align, Tag p_tag) {
+#ifdef MEMORY_TAGS_ENABLED
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -115,11 +132,11 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		uint8_t *s8 = (uint8_t *)mem;
 
 		uint64_t *s = (uint64_t *)(s8 + SIZE_OFFSET);
-		*s = p_bytes;
+		*s = p_bytes | (uint64_t(p_tag) << TAG_SHIFT);
 
-#ifdef DEBUG_ENABLED
-		uint64_t new_mem_usage = mem_usage.add(p_bytes);
-		max_usage.exchange_if_greater(new_mem_usage);
+#ifdef MEMORY_TAGS_ENABLED
+		_add_usage(mem_usage, max_usage, p_bytes);
+		_add_usage(tag_usage[p_tag], tag_max_usage[p_tag], p_bytes);
 #endif
 		return s8 + DATA_OFFSET;
 	} else {
@@ -127,6 +144,14 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	}
 }
 
+void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
+	return _alloc_static(p_bytes, p_pad_align, current_tag);
+}
+
+void *Memory::alloc_static_tagged(size_t p_bytes, Tag p_tag, bool p_pad_align) {
+	return _alloc_static(p_bytes, p_pad_align, p_tag);
+}
+
 void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (p_memory == nullptr) {
 		return alloc_static(p_bytes, p_pad_align);
@@ -134,7 +159,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_memory;
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_TAGS_ENABLED
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -143,13 +168,17 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-
-#ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
-			max_usage.exchange_if_greater(new_mem_usage);
+		uint64_t tag_bits = *s & ~SIZE_MASK;
+
+#ifdef MEMORY_TAGS_ENABLED
+		uint64_t prev_bytes = *s & SIZE_MASK;
+		Tag tag = Tag(*s >> TAG_SHIFT);
+		if (p_bytes > prev_bytes) {
+			_add_usage(mem_usage, max_usage, p_bytes - prev_bytes);
+			_add_usage(tag_usage[tag], tag_max_usage[tag], p_bytes - prev_bytes);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			mem_usage.sub(prev_bytes - p_bytes);
+			tag_usage[tag].sub(prev_bytes - p_bytes);
 		}
 #endif
 
@@ -157,14 +186,14 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			free(mem);
 			return nullptr;
 		} else {
-			*s = p_bytes;
+			*s = p_bytes | tag_bits;
 
 			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
 
-			*s = p_bytes;
+			*s = p_bytes | tag_bits;
 
 			return mem + DATA_OFFSET;
 		}
@@ -182,7 +211,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_ptr;
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_TAGS_ENABLED
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -193,9 +222,11 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_TAGS_ENABLED
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		mem_usage.sub(*s);
+		uint64_t bytes = *s & SIZE_MASK;
+		mem_usage.sub(bytes);
+		tag_usage[*s >> TAG_SHIFT].sub(bytes);
 #endif
 
 		free(mem);
@@ -204,12 +235,261 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	}
 }
 
+/* ARENA */
+
+namespace {
+
+struct ArenaBlock {
+	ArenaBlock *prev = nullptr;
+	size_t capacity = 0;
+	size_t used = 0;
+};
+
+constexpr size_t ARENA_ALIGN = alignof(max_align_t);
+constexpr size_t ARENA_BLOCK_HEADER = (sizeof(ArenaBlock) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+constexpr size_t ARENA_BLOCK_SIZE = 64 * 1024;
+// Every allocation is preceded by its requested size, the top bit marks heap fallbacks.
+constexpr size_t ARENA_ALLOC_HEADER = ARENA_ALIGN;
+constexpr uint64_t ARENA_HEAP_FLAG = uint64_t(1) << 63;
+constexpr uint32_t ARENA_MAX_TAGS = 64;
+
+struct ThreadArena {
+	ArenaBlock *current = nullptr;
+	ArenaBlock *spare = nullptr; // Standard sized blocks released by scopes, reused before allocating new ones.
+	// Where the innermost scope started, memory below it belongs to outer scopes.
+	ArenaBlock *scope_block = nullptr;
+	size_t scope_used = 0;
+	uint32_t scope_depth = 0;
+	uint64_t scope_bytes = 0;
+	uint64_t scope_calls = 0;
+
+	_FORCE_INLINE_ static uint8_t *get_data(ArenaBlock *p_block) {
+		return reinterpret_cast<uint8_t *>(p_block) + ARENA_BLOCK_HEADER;
+	}
+
+	// Whether the allocation at p_mem was made inside the innermost scope, so it is released when it ends.
+	bool is_in_scope(const uint8_t *p_mem) const {
+		for (ArenaBlock *block = current; block != scope_block; block = block->prev) {
+			if (p_mem >= get_data(block) && p_mem < get_data(block) + block->capacity) {
+				return true;
+			}
+		}
+		return scope_block && p_mem >= get_data(scope_block) + scope_used && p_mem < get_data(scope_block) + scope_block->capacity;
+	}
+
+	// Whether the allocation at p_mem is the most recent one and was made inside the innermost scope,
+	// only then it can be resized or freed in place without the scope end cutting it short.
+	_FORCE_INLINE_ bool is_last_in_scope(const uint8_t *p_mem, size_t p_size) const {
+		if (!current || p_mem + p_size != get_data(current) + current->used) {
+			return false;
+		}
+		return current != scope_block || p_mem >= get_data(current) + scope_used;
+	}
+
+	ArenaBlock *push_block(size_t p_bytes) {
+		ArenaBlock *block = nullptr;
+		if (spare && p_bytes <= ARENA_BLOCK_SIZE) {
+			block = spare;
+			spare = spare->prev;
+		} else {
+			size_t capacity = MAX(p_bytes, ARENA_BLOCK_SIZE);
+			block = static_cast<ArenaBlock *>(Memory::alloc_static(ARENA_BLOCK_HEADER + capacity));
+			CRASH_COND_MSG(!block, "Out of memory");
+			block->capacity = capacity;
+		}
+		block->used = 0;
+		block->prev = current;
+		current = block;
+		return block;
+	}
+
+	void pop_block() {
+		ArenaBlock *block = current;
+		current = block->prev;
+		if (block->capacity == ARENA_BLOCK_SIZE) {
+			block->prev = spare;
+			spare = block;
+		} else {
+			Memory::free_static(block);
+		}
+	}
+
+	~ThreadArena() {
+		while (current) {
+			pop_block();
+		}
+		while (spare) {
+			ArenaBlock *block = spare;
+			spare = spare->prev;
+			Memory::free_static(block);
+		}
+	}
+};
+
+thread_local ThreadArena thread_arena;
+
+BinaryMutex arena_tag_mutex;
+Memory::ArenaTagStats arena_tag_stats[ARENA_MAX_TAGS];
+uint32_t arena_tag_count = 0;
+
+_FORCE_INLINE_ size_t _arena_alloc_size(size_t p_bytes) {
+	return ARENA_ALLOC_HEADER + ((p_bytes + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1));
+}
+
+void *_arena_alloc_heap(size_t p_bytes) {
+	uint8_t *mem = static_cast<uint8_t *>(Memory::alloc_static(_arena_alloc_size(p_bytes)));
+	ERR_FAIL_NULL_V(mem, nullptr);
+	*reinterpret_cast<uint64_t *>(mem) = uint64_t(p_bytes) | ARENA_HEAP_FLAG;
+	return mem + ARENA_ALLOC_HEADER;
+}
+
+} // namespace
+
+void *Memory::alloc_arena(size_t p_bytes) {
+	ThreadArena &arena = thread_arena;
+	if (arena.scope_depth == 0) {
+		return _arena_alloc_heap(p_bytes);
+	}
+
+	size_t size = _arena_alloc_size(p_bytes);
+	ArenaBlock *block = arena.current;
+	if (!block || block->used + size > block->capacity) {
+		block = arena.push_block(size);
+	}
+	uint8_t *mem = ThreadArena::get_data(block) + block->used;
+	block->used += size;
+	*reinterpret_cast<uint64_t *>(mem) = p_bytes;
+
+	arena.scope_bytes += p_bytes;
+	arena.scope_calls++;
+	return mem + ARENA_ALLOC_HEADER;
+}
+
+void *Memory::realloc_arena(void *p_memory, size_t p_bytes) {
+	if (!p_memory) {
+		return alloc_arena(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free_arena(p_memory);
+		return nullptr;
+	}
+
+	uint8_t *mem = static_cast<uint8_t *>(p_memory) - ARENA_ALLOC_HEADER;
+	uint64_t header = *reinterpret_cast<uint64_t *>(mem);
+	if (header & ARENA_HEAP_FLAG) {
+		mem = static_cast<uint8_t *>(realloc_static(mem, _arena_alloc_size(p_bytes)));
+		ERR_FAIL_NULL_V(mem, nullptr);
+		*reinterpret_cast<uint64_t *>(mem) = uint64_t(p_bytes) | ARENA_HEAP_FLAG;
+		return mem + ARENA_ALLOC_HEADER;
+	}
+
+	// Grow or shrink in place if this is the most recent allocation of the innermost scope.
+	ThreadArena &arena = thread_arena;
+	size_t old_size = _arena_alloc_size(header);
+	if (arena.is_last_in_scope(mem, old_size)) {
+		ArenaBlock *block = arena.current;
+		size_t new_used = block->used - old_size + _arena_alloc_size(p_bytes);
+		if (new_used <= block->capacity) {
+			block->used = new_used;
+			*reinterpret_cast<uint64_t *>(mem) = p_bytes;
+			if (p_bytes > header) {
+				arena.scope_bytes += p_bytes - header;
+			}
+			arena.scope_calls++;
+			return p_memory;
+		}
+	}
+
+	// Allocations of outer scopes must outlive this one, so they are moved to the heap rather than
+	// to memory this scope releases when it ends.
+	void *new_memory = arena.is_in_scope(mem) ? alloc_arena(p_bytes) : _arena_alloc_heap(p_bytes);
+	ERR_FAIL_NULL_V(new_memory, nullptr);
+	memcpy(new_memory, p_memory, MIN(size_t(header), p_bytes));
+	return new_memory;
+}
+
+void Memory::free_arena(void *p_memory) {
+	if (!p_memory) {
+		return;
+	}
+
+	uint8_t *mem = static_cast<uint8_t *>(p_memory) - ARENA_ALLOC_HEADER;
+	uint64_t header = *reinterpret_cast<uint64_t *>(mem);
+	if (header & ARENA_HEAP_FLAG) {
+		free_static(mem);
+		return;
+	}
+
+	ThreadArena &arena = thread_arena;
+	size_t size = _arena_alloc_size(header);
+	if (arena.is_last_in_scope(mem, size)) {
+		arena.current->used -= size;
+	}
+}
+
+uint32_t Memory::get_arena_tag_stats(ArenaTagStats *r_stats, uint32_t p_max_stats) {
+	MutexLock lock(arena_tag_mutex);
+	uint32_t count = MIN(arena_tag_count, p_max_stats);
+	for (uint32_t i = 0; i < count; i++) {
+		r_stats[i] = arena_tag_stats[i];
+	}
+	return arena_tag_count;
+}
+
+ArenaScope::ArenaScope(const char *p_tag) {
+	ThreadArena &arena = thread_arena;
+	block = arena.current;
+	used = arena.current ? arena.current->used : 0;
+	parent_block = arena.scope_block;
+	parent_used = arena.scope_used;
+	arena.scope_block = arena.current;
+	arena.scope_used = used;
+	tag = p_tag;
+	parent_bytes = arena.scope_bytes;
+	parent_calls = arena.scope_calls;
+	arena.scope_bytes = 0;
+	arena.scope_calls = 0;
+	arena.scope_depth++;
+}
+
+ArenaScope::~ArenaScope() {
+	ThreadArena &arena = thread_arena;
+	while (arena.current != block) {
+		arena.pop_block();
+	}
+	if (arena.current) {
+		arena.current->used = used;
+	}
+	arena.scope_block = static_cast<ArenaBlock *>(parent_block);
+	arena.scope_used = parent_used;
+	arena.scope_depth--;
+
+	if (tag && arena.scope_calls) {
+		MutexLock lock(arena_tag_mutex);
+		uint32_t idx = 0;
+		while (idx < arena_tag_count && arena_tag_stats[idx].tag != tag && strcmp(arena_tag_stats[idx].tag, tag) != 0) {
+			idx++;
+		}
+		if (idx == arena_tag_count && arena_tag_count < ARENA_MAX_TAGS) {
+			arena_tag_stats[idx].tag = tag;
+			arena_tag_count++;
+		}
+		if (idx < arena_tag_count) {
+			arena_tag_stats[idx].bytes += arena.scope_bytes;
+			arena_tag_stats[idx].calls += arena.scope_calls;
+		}
+	}
+
+	arena.scope_bytes = parent_bytes;
+	arena.scope_calls = parent_calls;
+}
+
 uint64_t Memory::get_mem_available() {
 	return -1; // 0xFFFF...
 }
 
 uint64_t Memory::get_mem_usage() {
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_TAGS_ENABLED
 	return mem_usage.get();
 #else
 	return 0;
@@ -217,13 +497,58 @@ uint64_t Memory::get_mem_usage() {
 }
 
 uint64_t Memory::get_mem_max_usage() {
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_TAGS_ENABLED
 	return max_usage.get();
 #else
 	return 0;
 #endif
 }
 
+const char *Memory::get_tag_name(Tag p_tag) {
+	static const char *names[TAG_MAX] = {
+		"General",
+		"Resources",
+		"Scene",
+		"Scripting",
+		"Rendering",
+		"Physics",
+		"Audio",
+		"Navigation",
+	};
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, "");
+	return names[p_tag];
+}
+
+uint64_t Memory::get_tag_mem_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef MEMORY_TAGS_ENABLED
+	return tag_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_mem_max_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef MEMORY_TAGS_ENABLED
+	return tag_max_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+void Memory::print_tag_report() {
+#ifdef MEMORY_TAGS_ENABLED
+	// Printed with stdio, as this runs after the loggers are gone.
+	fprintf(stderr, "Static memory still allocated at exit: %" PRIu64 " bytes in %" PRIu64 " allocations.\n", mem_usage.get(), alloc_count.get());
+	for (int i = 0; i < TAG_MAX; i++) {
+		if (tag_usage[i].get() > 0) {
+			fprintf(stderr, "  %s: %" PRIu64 " bytes (peak: %" PRIu64 " bytes)\n", get_tag_name(Tag(i)), tag_usage[i].get(), tag_max_usage[i].get());
+		}
+	}
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
@@ -38,14 +38,40 @@
 #include <new>
 #include <type_traits>
 
+// Debug builds always track static memory, release builds only when built with `memory_tags=yes`.
+#if defined(DEBUG_ENABLED) && !defined(MEMORY_TAGS_ENABLED)
+#define MEMORY_TAGS_ENABLED
+#endif
+
 class Memory {
-#ifdef DEBUG_ENABLED
+public:
+	// Subsystem an allocation is accounted to. The tag is stored in the top byte of the size header.
+	enum Tag : uint8_t {
+		TAG_GENERAL,
+		TAG_RESOURCES,
+		TAG_SCENE,
+		TAG_SCRIPTING,
+		TAG_RENDERING,
+		TAG_PHYSICS,
+		TAG_AUDIO,
+		TAG_NAVIGATION,
+		TAG_MAX,
+	};
+
+private:
+#ifdef MEMORY_TAGS_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+	static SafeNumeric<uint64_t> tag_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_max_usage[TAG_MAX];
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
 
+	static thread_local Tag current_tag;
+
+	static void *_alloc_static(size_t p_bytes, bool p_pad_align, Tag p_tag);
+
 public:
 	// Alignment:  ↓ max_align_t        ↓ uint64_t          ↓ max_align_t
 	//             ┌─────────────────┬──┬────────────────┬──┬───────────...
@@ -59,9 +85,17 @@ public:
 	static constexpr size_t DATA_OFFSET = ((ELEMENT_OFFSET + sizeof(uint64_t)) % alignof(max_align_t) == 0) ? (ELEMENT_OFFSET + sizeof(uint64_t)) : ((ELEMENT_OFFSET + sizeof(uint64_t)) + alignof(max_align_t) - ((ELEMENT_OFFSET + sizeof(uint64_t)) % alignof(max_align_t)));
 
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
+	// Same as alloc_static, but accounted to p_tag instead of the current tag of the calling thread.
+	static void *alloc_static_tagged(size_t p_bytes, Tag p_tag, bool p_pad_align = false);
+	// Reallocations keep the tag of the original allocation.
 	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
 	static void free_static(void *p_ptr, bool p_pad_align = false);
 
+	// Allocations without an explicit tag are accounted to the current tag of the calling thread,
+	// see MemoryTagScope.
+	_FORCE_INLINE_ static Tag get_current_tag() { return current_tag; }
+	_FORCE_INLINE_ static void set_current_tag(Tag p_tag) { current_tag = p_tag; }
+
 	//	                            ↓ return value of alloc_aligned_static
 	//	┌─────────────────┬─────────┬─────────┬──────────────────┐
 	//	│ padding (up to  │ uint32_t│ void*   │ padding (up to   │
@@ -86,17 +120,79 @@ public:
 	//  free_aligned_static( data );
 	static void free_aligned_static(void *p_memory);
 
+	// Thread-local bump arena for short-lived allocations. The memory is reclaimed in bulk when the
+	// innermost ArenaScope of the calling thread ends, so arena memory must never outlive that scope.
+	// Freeing only gives memory back if it is the most recent allocation of the arena. Resizing an
+	// allocation of an outer scope moves it to the heap, so it is not released with the innermost scope.
+	// While no scope is open on the calling thread, these fall back to the heap.
+	static void *alloc_arena(size_t p_bytes);
+	static void *realloc_arena(void *p_memory, size_t p_bytes);
+	static void free_arena(void *p_memory);
+
+	struct ArenaTagStats {
+		const char *tag = nullptr;
+		uint64_t bytes = 0;
+		uint64_t calls = 0;
+	};
+	// Totals of the arena allocations made inside scopes with each tag, returns the number of tags.
+	static uint32_t get_arena_tag_stats(ArenaTagStats *r_stats, uint32_t p_max_stats);
+
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	static const char *get_tag_name(Tag p_tag);
+	static uint64_t get_tag_mem_usage(Tag p_tag);
+	static uint64_t get_tag_mem_max_usage(Tag p_tag);
+	// Prints the memory still allocated per tag, meant to be called at exit to report leaks.
+	static void print_tag_report();
+};
+
+// Accounts the allocations made by the calling thread to a tag until the scope ends.
+class MemoryTagScope {
+	Memory::Tag prev_tag;
+
+public:
+	_FORCE_INLINE_ explicit MemoryTagScope(Memory::Tag p_tag) {
+		prev_tag = Memory::get_current_tag();
+		Memory::set_current_tag(p_tag);
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+		Memory::set_current_tag(prev_tag);
+	}
+};
+
+// Opens an arena lifetime on the calling thread, everything allocated from the arena while it is
+// the innermost scope is released when it ends. p_tag must be a static string, it is used to account
+// the bytes and calls made inside the scope (nested scopes are accounted separately).
+class ArenaScope {
+	void *block = nullptr;
+	size_t used = 0;
+	void *parent_block = nullptr;
+	size_t parent_used = 0;
+	const char *tag = nullptr;
+	uint64_t parent_bytes = 0;
+	uint64_t parent_calls = 0;
+
+public:
+	explicit ArenaScope(const char *p_tag);
+	~ArenaScope();
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
+class ArenaAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_arena(p_memory); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return Memory::realloc_arena(p_ptr, p_memory); }
+	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_arena(p_ptr); }
+};
+
 void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
 
@@ -111,6 +207,7 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #endif
 
 #define memalloc(m_size) Memory::alloc_static(m_size)
+#define memalloc_tagged(m_size, m_tag) Memory::alloc_static_tagged(m_size, m_tag)
 #define memrealloc(m_mem, m_size) Memory::realloc_static(m_mem, m_size)
 #define memfree(m_mem) Memory::free_static(m_mem)
 
@@ -123,6 +220,8 @@ _ALWAYS_INLINE_ T *_post_initialize(T *p_obj) {
 }
 
 #define memnew(m_class) _post_initialize(::new ("") m_class)
+// The object and everything its constructor allocates are accounted to m_tag.
+#define memnew_tagged(m_tag, m_class) (MemoryTagScope(m_tag), memnew(m_class))
 
 #define memnew_allocator(m_class, m_allocator) _post_initialize(::new (m_allocator::alloc) m_class)
 #define memnew_placement(m_placement, m_class) _post_initialize(::new (m_placement) m_class)
@@ -245,4 +344,18 @@ public:
 	_FORCE_INLINE_ void delete_allocation(T *p_allocation) { memdelete(p_allocation); }
 };
 
+// For HashMap and friends, elements are allocated from the thread arena (see Memory::alloc_arena).
+template <typename T>
+class ArenaTypedAllocator {
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_placement(Memory::alloc_arena(sizeof(T)), T(p_args...)); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			p_allocation->~T();
+		}
+		Memory::free_arena(p_allocation);
+	}
+};
+
 #endif // MEMORY_H
@@ -330,6 +330,18 @@ uint64_t OS::get_static_memory_peak_usage() const {
 	return Memory::get_mem_max_usage();
 }
 
+Dictionary OS::get_static_memory_usage_by_tag() const {
+	Dictionary usage;
+	for (int i = 0; i < Memory::TAG_MAX; i++) {
+		Memory::Tag tag = Memory::Tag(i);
+		Dictionary tag_usage;
+		tag_usage["usage"] = Memory::get_tag_mem_usage(tag);
+		tag_usage["peak"] = Memory::get_tag_mem_max_usage(tag);
+		usage[Memory::get_tag_name(tag)] = tag_usage;
+	}
+	return usage;
+}
+
 Error OS::set_cwd(const String &p_cwd) {
 	return ERR_CANT_OPEN;
 }
@@ -272,6 +272,7 @@ public:
 
 	virtual uint64_t get_static_memory_usage() const;
 	virtual uint64_t get_static_memory_peak_usage() const;
+	virtual Dictionary get_static_memory_usage_by_tag() const;
 	virtual Dictionary get_memory_info() const;
 
 	bool is_separate_thread_rendering_enabled() const { return _separate_thread_render; }
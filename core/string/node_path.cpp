@@ -401,37 +401,38 @@ NodePath::NodePath(const String &p_path) {
 		return;
 	}
 
-	String path = p_path;
+	// Names are looked up straight from ranges of p_path, without copying them to intermediate strings.
+	const char32_t *path = p_path.ptr();
+	int path_len = p_path.length();
 	Vector<StringName> subpath;
 
 	bool absolute = (path[0] == '/');
 	bool last_is_slash = true;
 	int slices = 0;
-	int subpath_pos = path.find_char(':');
+	int subpath_pos = p_path.find_char(':');
 
 	if (subpath_pos != -1) {
 		int from = subpath_pos + 1;
 
-		for (int i = from; i <= path.length(); i++) {
-			if (path[i] == ':' || path[i] == 0) {
-				String str = path.substr(from, i - from);
-				if (str.is_empty()) {
-					if (path[i] == 0) {
+		for (int i = from; i <= path_len; i++) {
+			if (i == path_len || path[i] == ':') {
+				if (i == from) {
+					if (i == path_len) {
 						continue; // Allow end-of-path :
 					}
 
 					ERR_FAIL_MSG(vformat("Invalid NodePath '%s'.", p_path));
 				}
-				subpath.push_back(str);
+				subpath.push_back(StringName(StrRange(path + from, i - from)));
 
 				from = i + 1;
 			}
 		}
 
-		path = path.substr(0, subpath_pos);
+		path_len = subpath_pos;
 	}
 
-	for (int i = (int)absolute; i < path.length(); i++) {
+	for (int i = (int)absolute; i < path_len; i++) {
 		if (path[i] == '/') {
 			last_is_slash = true;
 		} else {
@@ -461,12 +462,11 @@ NodePath::NodePath(const String &p_path) {
 	int from = (int)absolute;
 	int slice = 0;
 
-	for (int i = (int)absolute; i < path.length() + 1; i++) {
-		if (path[i] == '/' || path[i] == 0) {
+	for (int i = (int)absolute; i < path_len + 1; i++) {
+		if (i == path_len || path[i] == '/') {
 			if (!last_is_slash) {
-				String name = path.substr(from, i - from);
 				ERR_FAIL_INDEX(slice, data->path.size());
-				data->path.write[slice++] = name;
+				data->path.write[slice++] = StringName(StrRange(path + from, i - from));
 			}
 			from = i + 1;
 			last_is_slash = true;
@@ -63,6 +63,20 @@ bool StringName::_Data::operator!=(const char *p_name) const {
 	return !operator==(p_name);
 }
 
+bool StringName::_Data::operator==(const StrRange<char32_t> &p_name) const {
+	if (cname) {
+		for (size_t i = 0; i < p_name.len; i++) {
+			// static_cast: avoid negative values on platforms where char is signed.
+			if (cname[i] == 0 || static_cast<uint8_t>(cname[i]) != p_name.c_str[i]) {
+				return false;
+			}
+		}
+		return cname[p_name.len] == 0;
+	} else {
+		return name == p_name;
+	}
+}
+
 StringName _scs_create(const char *p_chr, bool p_static) {
 	return (p_chr[0] ? StringName(StaticCString::create(p_chr), p_static) : StringName());
 }
@@ -135,7 +149,7 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		MutexLock lock(_get_table_mutex(_data->idx));
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -269,12 +283,11 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -328,12 +341,11 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -388,11 +400,11 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_data = _table[idx];
 
 	while (_data) {
@@ -438,6 +450,51 @@ StringName::StringName(const String &p_name, bool p_static) {
 	_table[idx] = _data;
 }
 
+StringName::StringName(const StrRange<char32_t> &p_name, bool p_static) {
+	_data = nullptr;
+
+	ERR_FAIL_COND(!configured);
+
+	if (p_name.len == 0) {
+		return;
+	}
+
+	uint32_t hash = String::hash(p_name.c_str, p_name.len);
+	uint32_t idx = hash & STRING_TABLE_MASK;
+
+	{
+		MutexLock lock(_get_table_mutex(idx));
+
+		_data = _table[idx];
+
+		while (_data) {
+			if (_data->hash == hash && _data->operator==(p_name)) {
+				break;
+			}
+			_data = _data->next;
+		}
+
+		if (_data && _data->refcount.ref()) {
+			// exists
+			if (p_static) {
+				_data->static_count.increment();
+			}
+#ifdef DEBUG_ENABLED
+			if (unlikely(debug_stringname)) {
+				_data->debug_references++;
+			}
+#endif
+			return;
+		}
+		_data = nullptr;
+	}
+
+	// Not found, create it from a String, which looks it up again in case another thread added it meanwhile.
+	StringName name(String(p_name), p_static);
+	_data = name._data;
+	name._data = nullptr;
+}
+
 StringName StringName::search(const char *p_name) {
 	ERR_FAIL_COND_V(!configured, StringName());
 
@@ -446,11 +503,11 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -482,17 +539,17 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = String::hash(p_name);
-
+	const StrRange<char32_t> name = StrRange<char32_t>::from_c_str(p_name);
+	uint32_t hash = String::hash(name.c_str, name.len);
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
 		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
+		if (_data->hash == hash && _data->operator==(name)) {
 			break;
 		}
 		_data = _data->next;
@@ -508,12 +565,11 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-
 	uint32_t idx = hash & STRING_TABLE_MASK;
 
+	MutexLock lock(_get_table_mutex(idx));
+
 	_Data *_data = _table[idx];
 
 	while (_data) {
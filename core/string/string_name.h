@@ -48,7 +48,11 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// Buckets are guarded by one of several locks, so threads interning different names rarely contend.
+		STRING_TABLE_SHARD_BITS = 6,
+		STRING_TABLE_SHARD_LEN = 1 << STRING_TABLE_SHARD_BITS,
+		STRING_TABLE_SHARD_MASK = STRING_TABLE_SHARD_LEN - 1
 	};
 
 	struct _Data {
@@ -64,6 +68,7 @@ class StringName {
 		bool operator!=(const String &p_name) const;
 		bool operator==(const char *p_name) const;
 		bool operator!=(const char *p_name) const;
+		bool operator==(const StrRange<char32_t> &p_name) const;
 
 		int idx = 0;
 		uint32_t hash = 0;
@@ -74,6 +79,15 @@ class StringName {
 
 	static inline _Data *_table[STRING_TABLE_LEN];
 
+	struct alignas(64) TableShard {
+		Mutex mutex;
+	};
+	static inline TableShard _table_shards[STRING_TABLE_SHARD_LEN];
+
+	_FORCE_INLINE_ static Mutex &_get_table_mutex(uint32_t p_idx) {
+		return _table_shards[p_idx & STRING_TABLE_SHARD_MASK].mutex;
+	}
+
 	_Data *_data = nullptr;
 
 	void unref();
@@ -191,6 +205,8 @@ public:
 	StringName(const char *p_name, bool p_static = false);
 	StringName(const StringName &p_name);
 	StringName(const String &p_name, bool p_static = false);
+	// Only allocates a String if the name doesn't exist yet.
+	explicit StringName(const StrRange<char32_t> &p_name, bool p_static = false);
 	StringName(const StaticCString &p_static_string, bool p_static = false);
 	StringName() {}
 
@@ -359,11 +359,12 @@ void String::copy_from(const char32_t &p_char) {
 // p_char != nullptr
 // p_length > 0
 // p_length <= p_char strlen
-void String::copy_from_unchecked(const char32_t *p_char, const int p_length) {
-	resize(p_length + 1);
+// p_offset <= length()
+void String::copy_from_unchecked(const char32_t *p_char, const int p_length, const int p_offset) {
+	resize(p_offset + p_length + 1);
 
 	const char32_t *end = p_char + p_length;
-	char32_t *dst = ptrw();
+	char32_t *dst = ptrw() + p_offset;
 
 	for (; p_char < end; ++p_char, ++dst) {
 		const char32_t chr = *p_char;
@@ -475,13 +476,29 @@ String &String::operator+=(const wchar_t *p_str) {
 	*this += String::utf16((const char16_t *)p_str);
 #else
 	// wchar_t is 32-bit
-	*this += String((const char32_t *)p_str);
+	*this += StrRange<char32_t>::from_c_str((const char32_t *)p_str);
 #endif
 	return *this;
 }
 
 String &String::operator+=(const char32_t *p_str) {
-	*this += String(p_str);
+	*this += StrRange<char32_t>::from_c_str(p_str);
+	return *this;
+}
+
+String &String::operator+=(const StrRange<char32_t> &p_str_range) {
+	if (p_str_range.len == 0) {
+		return *this;
+	}
+
+	const int lhs_len = length();
+	if (unlikely(p_str_range.c_str >= ptr() && p_str_range.c_str < ptr() + lhs_len)) {
+		// Appending part of itself, resizing could move the characters.
+		*this += String(p_str_range);
+		return *this;
+	}
+
+	copy_from_unchecked(p_str_range.c_str, p_str_range.len, lhs_len);
 	return *this;
 }
 
@@ -272,7 +272,7 @@ class String {
 	void copy_from(const StrRange<char> &p_cstr);
 	void copy_from(const StrRange<char32_t> &p_cstr);
 	void copy_from(const char32_t &p_char);
-	void copy_from_unchecked(const char32_t *p_char, int p_length);
+	void copy_from_unchecked(const char32_t *p_char, int p_length, int p_offset = 0);
 
 	// NULL-terminated c string copy - automatically parse the string to find the length.
 	void copy_from(const char *p_cstr) {
@@ -360,6 +360,7 @@ public:
 	String &operator+=(const char *p_str);
 	String &operator+=(const wchar_t *p_str);
 	String &operator+=(const char32_t *p_str);
+	String &operator+=(const StrRange<char32_t> &p_str_range);
 
 	bool operator==(const char *p_str) const;
 	bool operator==(const wchar_t *p_str) const;
@@ -633,6 +634,14 @@ public:
 		copy_from(p_cstr, p_clip_to_len);
 	}
 
+	// Constructors for known-length strings, the range doesn't need to be NULL terminated.
+	explicit String(const StrRange<char> &p_str_range) {
+		copy_from(p_str_range);
+	}
+	explicit String(const StrRange<char32_t> &p_str_range) {
+		copy_from(p_str_range);
+	}
+
 	// Copy assignment for NULL terminated C strings.
 	void operator=(const char *p_cstr) {
 		copy_from(p_cstr);
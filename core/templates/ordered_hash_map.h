@@ -0,0 +1,641 @@
+/**************************************************************************/
+/*  ordered_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ORDERED_HASH_MAP_H
+#define ORDERED_HASH_MAP_H
+
+#include "core/templates/hash_map.h"
+
+/**
+ * A hash map that keeps the insertion order, laid out like CPython's dict:
+ * the elements and their hashes are stored in a dense array in insertion
+ * order, and the open addressing table only stores indices into it. The
+ * index width is 8, 16 or 32 bits depending on the table size, so small
+ * maps use very little memory, and iteration is a walk over contiguous memory.
+ *
+ * Erasing leaves a hole in the entries, which iteration skips, so the order
+ * of the remaining elements is kept. Holes are compacted when the table
+ * grows. The stored hashes are reused when rebuilding the table, so keys
+ * are never hashed twice.
+ *
+ * Each element is allocated on its own, like in HashMap, so pointers to
+ * keys and values stay valid until the element is erased. Growing and
+ * compacting only move the pointers in the dense array.
+ *
+ * All lookups can take a precomputed hash, which must be the same as
+ * `Hasher::hash(p_key)`.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class OrderedHashMap {
+public:
+	// Must be a power of two.
+	static constexpr uint32_t MIN_CAPACITY = 8;
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	struct Entry {
+		MapKeyValue *data = nullptr;
+		uint32_t hash = DELETED_HASH;
+	};
+
+	// Entries with this hash are holes left by erasing.
+	static constexpr uint32_t DELETED_HASH = 0;
+
+	// Index slots hold the entry index + 1, empty slots are 0 and deleted slots the largest value of their width.
+	static constexpr uint32_t INDEX_EMPTY = 0;
+
+	Entry *entries = nullptr;
+	void *indices = nullptr;
+
+	// Size of the index table, always a power of two.
+	uint32_t capacity = MIN_CAPACITY;
+	uint32_t num_elements = 0;
+	// Entries used, including holes.
+	uint32_t entries_used = 0;
+	// Index slots that are not empty, including deleted ones.
+	uint32_t indices_used = 0;
+
+	static _FORCE_INLINE_ uint32_t _get_usable(uint32_t p_capacity) {
+		return (p_capacity << 1) / 3; // Maximum load factor of 2/3.
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_index_width(uint32_t p_capacity) {
+		return p_capacity <= 0x100 ? 1 : (p_capacity <= 0x10000 ? 2 : 4);
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_index_deleted(uint32_t p_width) {
+		return p_width == 1 ? 0xFF : (p_width == 2 ? 0xFFFF : 0xFFFFFFFF);
+	}
+
+	static _FORCE_INLINE_ uint32_t _hash_fix(uint32_t p_hash) {
+		return unlikely(p_hash == DELETED_HASH) ? DELETED_HASH + 1 : p_hash;
+	}
+
+	_FORCE_INLINE_ uint32_t _get_index(uint32_t p_slot) const {
+		if (capacity <= 0x100) {
+			return static_cast<const uint8_t *>(indices)[p_slot];
+		} else if (capacity <= 0x10000) {
+			return static_cast<const uint16_t *>(indices)[p_slot];
+		}
+		return static_cast<const uint32_t *>(indices)[p_slot];
+	}
+
+	_FORCE_INLINE_ void _set_index(uint32_t p_slot, uint32_t p_value) {
+		if (capacity <= 0x100) {
+			static_cast<uint8_t *>(indices)[p_slot] = p_value;
+		} else if (capacity <= 0x10000) {
+			static_cast<uint16_t *>(indices)[p_slot] = p_value;
+		} else {
+			static_cast<uint32_t *>(indices)[p_slot] = p_value;
+		}
+	}
+
+	// Probes with the perturbation sequence of CPython, which uses all the hash bits and tolerates weak hashes.
+	bool _lookup_slot(const TKey &p_key, uint32_t p_hash, uint32_t &r_slot) const {
+		if (unlikely(entries == nullptr)) {
+			return false; // Failed lookups, no elements.
+		}
+
+		const uint32_t mask = capacity - 1;
+		const uint32_t deleted = _get_index_deleted(_get_index_width(capacity));
+		uint32_t perturb = p_hash;
+		uint32_t slot = p_hash & mask;
+		while (true) {
+			uint32_t index = _get_index(slot);
+			if (index == INDEX_EMPTY) {
+				return false;
+			}
+			if (index != deleted) {
+				const Entry &entry = entries[index - 1];
+				if (entry.hash == p_hash && Comparator::compare(entry.data->key, p_key)) {
+					r_slot = slot;
+					return true;
+				}
+			}
+			perturb >>= 5;
+			slot = (slot * 5 + perturb + 1) & mask;
+		}
+	}
+
+	_FORCE_INLINE_ Entry *_lookup(const TKey &p_key, uint32_t p_hash) const {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, p_hash, slot)) {
+			return nullptr;
+		}
+		return &entries[_get_index(slot) - 1];
+	}
+
+	void _insert_index(uint32_t p_hash, uint32_t p_entry) {
+		const uint32_t mask = capacity - 1;
+		uint32_t perturb = p_hash;
+		uint32_t slot = p_hash & mask;
+		while (_get_index(slot) != INDEX_EMPTY) {
+			perturb >>= 5;
+			slot = (slot * 5 + perturb + 1) & mask;
+		}
+		_set_index(slot, p_entry + 1);
+		indices_used++;
+	}
+
+	// Moves the elements to the start of the entries, removing the holes while keeping the order.
+	void _compact_entries() {
+		if (entries_used == num_elements) {
+			return;
+		}
+		uint32_t to = 0;
+		for (uint32_t from = 0; from < entries_used; from++) {
+			if (entries[from].hash == DELETED_HASH) {
+				continue;
+			}
+			if (from != to) {
+				memcpy((void *)&entries[to], (const void *)&entries[from], sizeof(Entry));
+			}
+			to++;
+		}
+		entries_used = num_elements;
+	}
+
+	void _rebuild_indices() {
+		memset(indices, 0, capacity * _get_index_width(capacity));
+		indices_used = 0;
+		for (uint32_t i = 0; i < entries_used; i++) {
+			_insert_index(entries[i].hash, i);
+		}
+	}
+
+	void _resize(uint32_t p_min_elements) {
+		_compact_entries();
+
+		uint32_t new_capacity = MIN_CAPACITY;
+		while (_get_usable(new_capacity) < p_min_elements) {
+			new_capacity <<= 1;
+		}
+
+		if (new_capacity != capacity || indices == nullptr) {
+			capacity = new_capacity;
+			Memory::free_static(indices);
+			indices = Memory::alloc_static(capacity * _get_index_width(capacity));
+			entries = reinterpret_cast<Entry *>(Memory::realloc_static(entries, sizeof(Entry) * _get_usable(capacity)));
+		}
+		_rebuild_indices();
+	}
+
+	Entry *_insert_entry(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(indices_used >= _get_usable(capacity) || entries == nullptr)) {
+			_resize(num_elements + (num_elements >> 1) + 1); // Also compacts the holes left by erasing.
+		}
+
+		Entry *entry = &entries[entries_used];
+		entry->data = memnew(MapKeyValue(p_key, p_value));
+		entry->hash = p_hash;
+		_insert_index(p_hash, entries_used);
+		entries_used++;
+		num_elements++;
+		return entry;
+	}
+
+	void _erase_slot(uint32_t p_slot) {
+		uint32_t index = _get_index(p_slot) - 1;
+		_set_index(p_slot, _get_index_deleted(_get_index_width(capacity)));
+
+		Entry &entry = entries[index];
+		memdelete(entry.data);
+		entry.data = nullptr;
+		entry.hash = DELETED_HASH;
+		num_elements--;
+
+		if (num_elements == 0) {
+			// Nothing left to keep, drop the deleted slots too.
+			memset(indices, 0, capacity * _get_index_width(capacity));
+			entries_used = 0;
+			indices_used = 0;
+			return;
+		}
+
+		// Trailing holes can be reused right away, which makes stack-like use cheap.
+		while (entries[entries_used - 1].hash == DELETED_HASH) {
+			entries_used--;
+		}
+	}
+
+	void _init_from(const OrderedHashMap &p_other) {
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		capacity = MIN_CAPACITY;
+		while (_get_usable(capacity) < p_other.num_elements) {
+			capacity <<= 1;
+		}
+		indices = Memory::alloc_static(capacity * _get_index_width(capacity));
+		entries = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * _get_usable(capacity)));
+
+		for (uint32_t i = 0; i < p_other.entries_used; i++) {
+			const Entry &other = p_other.entries[i];
+			if (other.hash == DELETED_HASH) {
+				continue;
+			}
+			entries[entries_used].data = memnew(MapKeyValue(*other.data));
+			entries[entries_used].hash = other.hash;
+			entries_used++;
+		}
+		num_elements = entries_used;
+		_rebuild_indices();
+	}
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return _get_usable(capacity); }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (entries == nullptr) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < entries_used; i++) {
+			if (entries[i].hash != DELETED_HASH) {
+				memdelete(entries[i].data);
+			}
+		}
+		memset(indices, 0, capacity * _get_index_width(capacity));
+		num_elements = 0;
+		entries_used = 0;
+		indices_used = 0;
+	}
+
+	// Sorts the elements by key, with the same ordering as HashMap::sort().
+	void sort() {
+		if (num_elements < 2) {
+			return; // An empty or single element map is already sorted.
+		}
+		_compact_entries();
+
+		// Insertion sort, as the input is often already sorted or nearly sorted.
+		uint8_t temp[sizeof(Entry)];
+		for (uint32_t i = 1; i < num_elements; i++) {
+			uint32_t j = i;
+			while (j > 0 && _hashmap_variant_less_than(entries[i].data->key, entries[j - 1].data->key)) {
+				j--;
+			}
+			if (j != i) {
+				memcpy(temp, (const void *)&entries[i], sizeof(Entry));
+				memmove((void *)&entries[j + 1], (const void *)&entries[j], sizeof(Entry) * (i - j));
+				memcpy((void *)&entries[j], temp, sizeof(Entry));
+			}
+		}
+		_rebuild_indices();
+	}
+
+	TValue &get(const TKey &p_key) {
+		Entry *entry = _lookup(p_key, _hash_fix(Hasher::hash(p_key)));
+		CRASH_COND_MSG(!entry, "OrderedHashMap key not found.");
+		return entry->data->value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		const Entry *entry = _lookup(p_key, _hash_fix(Hasher::hash(p_key)));
+		CRASH_COND_MSG(!entry, "OrderedHashMap key not found.");
+		return entry->data->value;
+	}
+
+	const TValue *getptr(const TKey &p_key, uint32_t p_hash) const {
+		const Entry *entry = _lookup(p_key, _hash_fix(p_hash));
+		return entry ? &entry->data->value : nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key, uint32_t p_hash) {
+		Entry *entry = _lookup(p_key, _hash_fix(p_hash));
+		return entry ? &entry->data->value : nullptr;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		return getptr(p_key, Hasher::hash(p_key));
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		return getptr(p_key, Hasher::hash(p_key));
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key, uint32_t p_hash) const {
+		return _lookup(p_key, _hash_fix(p_hash)) != nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return has(p_key, Hasher::hash(p_key));
+	}
+
+	bool erase(const TKey &p_key, uint32_t p_hash) {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, _hash_fix(p_hash), slot)) {
+			return false;
+		}
+		_erase_slot(slot);
+		return true;
+	}
+
+	bool erase(const TKey &p_key) {
+		return erase(p_key, Hasher::hash(p_key));
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		if (p_new_capacity <= get_capacity() && entries != nullptr) {
+			return;
+		}
+		_resize(MAX(p_new_capacity, num_elements));
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return *entry->data;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return entry->data;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			do {
+				entry++;
+			} while (entry < end && entry->hash == DELETED_HASH);
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			while (entry > begin) {
+				entry--;
+				if (entry->hash != DELETED_HASH) {
+					return *this;
+				}
+			}
+			entry = end;
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return entry == b.entry; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return entry != b.entry; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return entry != end;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const Entry *p_entry, const Entry *p_begin, const Entry *p_end) {
+			entry = p_entry;
+			begin = p_begin;
+			end = p_end;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		const Entry *entry = nullptr;
+		const Entry *begin = nullptr;
+		const Entry *end = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return *entry->data;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return entry->data;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			do {
+				entry++;
+			} while (entry < end && entry->hash == DELETED_HASH);
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			while (entry > begin) {
+				entry--;
+				if (entry->hash != DELETED_HASH) {
+					return *this;
+				}
+			}
+			entry = end;
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return entry == b.entry; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return entry != b.entry; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return entry != end;
+		}
+
+		_FORCE_INLINE_ Iterator(Entry *p_entry, Entry *p_begin, Entry *p_end) {
+			entry = p_entry;
+			begin = p_begin;
+			end = p_end;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(entry, begin, end);
+		}
+
+	private:
+		Entry *entry = nullptr;
+		Entry *begin = nullptr;
+		Entry *end = nullptr;
+	};
+
+private:
+	_FORCE_INLINE_ Entry *_first_entry() const {
+		Entry *entry = entries;
+		Entry *end = entries + entries_used;
+		while (entry < end && entry->hash == DELETED_HASH) {
+			entry++;
+		}
+		return entry;
+	}
+
+public:
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(_first_entry(), entries, entries + entries_used);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(entries + entries_used, entries, entries + entries_used);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		if (unlikely(num_elements == 0)) {
+			return Iterator(nullptr, nullptr, nullptr);
+		}
+		// The last entry is never a hole.
+		return Iterator(entries + entries_used - 1, entries, entries + entries_used);
+	}
+
+	Iterator find(const TKey &p_key, uint32_t p_hash) {
+		Entry *entry = _lookup(p_key, _hash_fix(p_hash));
+		if (!entry) {
+			return end();
+		}
+		return Iterator(entry, entries, entries + entries_used);
+	}
+
+	Iterator find(const TKey &p_key) {
+		return find(p_key, Hasher::hash(p_key));
+	}
+
+	void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(_first_entry(), entries, entries + entries_used);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(entries + entries_used, entries, entries + entries_used);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		if (unlikely(num_elements == 0)) {
+			return ConstIterator(nullptr, nullptr, nullptr);
+		}
+		return ConstIterator(entries + entries_used - 1, entries, entries + entries_used);
+	}
+
+	ConstIterator find(const TKey &p_key, uint32_t p_hash) const {
+		const Entry *entry = _lookup(p_key, _hash_fix(p_hash));
+		if (!entry) {
+			return end();
+		}
+		return ConstIterator(entry, entries, entries + entries_used);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		return find(p_key, Hasher::hash(p_key));
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		const Entry *entry = _lookup(p_key, _hash_fix(Hasher::hash(p_key)));
+		CRASH_COND(!entry);
+		return entry->data->value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t hash = _hash_fix(Hasher::hash(p_key));
+		Entry *entry = _lookup(p_key, hash);
+		if (!entry) {
+			entry = _insert_entry(p_key, TValue(), hash);
+		}
+		return entry->data->value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		uint32_t hash = _hash_fix(p_hash);
+		Entry *entry = _lookup(p_key, hash);
+		if (entry) {
+			entry->data->value = p_value;
+		} else {
+			entry = _insert_entry(p_key, p_value, hash);
+		}
+		return Iterator(entry, entries, entries + entries_used);
+	}
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		return insert(p_key, p_value, Hasher::hash(p_key));
+	}
+
+	/* Array methods. */
+
+	// Returns the element at the position p_index in insertion order. Constant time unless elements were erased.
+	const KeyValue<TKey, TValue> &get_by_index(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		if (entries_used == num_elements) {
+			return *entries[p_index].data;
+		}
+		const Entry *entry = _first_entry();
+		for (uint32_t i = 0; i < p_index; i++) {
+			do {
+				entry++;
+			} while (entry->hash == DELETED_HASH);
+		}
+		return *entry->data;
+	}
+
+	/* Constructors */
+
+	OrderedHashMap(const OrderedHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	void operator=(const OrderedHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+
+		_init_from(p_other);
+	}
+
+	OrderedHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	OrderedHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	OrderedHashMap() {}
+
+	void reset() {
+		if (entries != nullptr) {
+			clear();
+			Memory::free_static(entries);
+			Memory::free_static(indices);
+			entries = nullptr;
+			indices = nullptr;
+		}
+		capacity = MIN_CAPACITY;
+	}
+
+	~OrderedHashMap() {
+		reset();
+	}
+};
+
+#endif // ORDERED_HASH_MAP_H
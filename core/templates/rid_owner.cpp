@@ -31,3 +31,31 @@
 #include "rid_owner.h"
 
 SafeNumeric<uint64_t> RID_AllocBase::base_id{ 1 };
+
+static constexpr uint32_t THREAD_ID_BLOCK_SIZE = 256;
+static thread_local uint64_t thread_next_id = 0;
+static thread_local uint64_t thread_end_id = 0;
+
+static SafeNumeric<uint32_t> thread_index_count;
+static thread_local uint32_t thread_index = UINT32_MAX;
+
+uint64_t RID_AllocBase::_gen_ids(uint32_t p_count) {
+	if (unlikely(p_count > thread_end_id - thread_next_id)) {
+		if (p_count >= THREAD_ID_BLOCK_SIZE) {
+			return base_id.add(p_count) - p_count + 1;
+		}
+		// Unused ids of the previous block are dropped, like any id of a freed RID.
+		thread_end_id = base_id.add(THREAD_ID_BLOCK_SIZE) + 1;
+		thread_next_id = thread_end_id - THREAD_ID_BLOCK_SIZE;
+	}
+	uint64_t id = thread_next_id;
+	thread_next_id += p_count;
+	return id;
+}
+
+uint32_t RID_AllocBase::_get_thread_index() {
+	if (unlikely(thread_index == UINT32_MAX)) {
+		thread_index = thread_index_count.postincrement();
+	}
+	return thread_index;
+}
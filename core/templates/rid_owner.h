@@ -40,6 +40,7 @@
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
 
+#include <atomic>
 #include <stdio.h>
 #include <typeinfo>
 
@@ -63,6 +64,11 @@ protected:
 		return base_id.increment();
 	}
 
+	// Returns the first of p_count consecutive unique ids. Each thread reserves them in blocks, so this rarely touches base_id.
+	static uint64_t _gen_ids(uint32_t p_count);
+	// Small number unique to the calling thread, used to give each thread its own free list.
+	static uint32_t _get_thread_index();
+
 public:
 	virtual ~RID_AllocBase() {}
 };
@@ -71,79 +77,179 @@ template <typename T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
 	struct Chunk {
 		T data;
-		uint32_t validator;
+		std::atomic<uint32_t> validator;
 	};
 	Chunk **chunks = nullptr;
-	uint32_t **free_list_chunks = nullptr;
+	// Free elements form linked lists, each element stores the index + 1 of the next free one, 0 ends the list.
+	std::atomic<uint32_t> **free_list_chunks = nullptr;
+
+	// Thread safe allocators spread the free elements over several lists, each thread pushes to and pops from its own first.
+	static constexpr uint32_t FREE_LIST_COUNT = THREAD_SAFE ? 8 : 1;
+	// Maximum number of elements popped from a list at once.
+	static constexpr uint32_t FREE_LIST_BATCH = 64;
+
+	struct FreeList {
+		// Index + 1 of the first free element in the lower 32 bits, a tag changed on every update in the upper ones, so popping can't suffer from ABA.
+		std::atomic<uint64_t> head = { 0 };
+		uint8_t padding[64 - sizeof(std::atomic<uint64_t>)]; // Keep each list in its own cache line.
+	};
+	FreeList free_lists[FREE_LIST_COUNT];
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
-	uint32_t alloc_count = 0;
+	SafeNumeric<uint32_t> max_alloc;
+	SafeNumeric<uint32_t> alloc_count;
 	uint32_t chunk_limit = 0;
 
 	const char *description = nullptr;
 
-	mutable Mutex mutex;
+	mutable Mutex mutex; // Only taken to add chunks.
 
-	_FORCE_INLINE_ RID _allocate_rid() {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
+	_FORCE_INLINE_ std::atomic<uint32_t> &_get_next_free(uint32_t p_index) const {
+		return free_list_chunks[p_index / elements_in_chunk][p_index % elements_in_chunk];
+	}
 
-		if (alloc_count == max_alloc) {
-			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
-			if (THREAD_SAFE && chunk_count == chunk_limit) {
-				mutex.unlock();
-				if (description != nullptr) {
-					ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
-				} else {
-					ERR_FAIL_V_MSG(RID(), "Element limit reached.");
-				}
+	// Pops up to p_count elements with a single update of the list, returns how many were popped.
+	uint32_t _pop_free(FreeList &p_list, uint32_t *r_indices, uint32_t p_count) {
+		uint64_t head = p_list.head.load(std::memory_order_acquire);
+		while (true) {
+			uint32_t next = uint32_t(head);
+			uint32_t count = 0;
+			while (next != 0 && count < p_count) {
+				r_indices[count++] = next - 1;
+				// May read a link that another thread is changing, the tag check below discards the result then.
+				next = _get_next_free(next - 1).load(std::memory_order_relaxed);
 			}
-
-			//grow chunks
-			if constexpr (!THREAD_SAFE) {
-				chunks = (Chunk **)memrealloc(chunks, sizeof(Chunk *) * (chunk_count + 1));
+			if (count == 0) {
+				return 0;
 			}
-			chunks[chunk_count] = (Chunk *)memalloc(sizeof(Chunk) * elements_in_chunk); //but don't initialize
-			//grow free lists
-			if constexpr (!THREAD_SAFE) {
-				free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
+
+			const uint64_t new_head = (((head >> 32) + 1) << 32) | next;
+			if constexpr (THREAD_SAFE) {
+				if (p_list.head.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire)) {
+					return count;
+				}
+			} else {
+				p_list.head.store(new_head, std::memory_order_relaxed);
+				return count;
 			}
-			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
+		}
+	}
 
-			//initialize
-			for (uint32_t i = 0; i < elements_in_chunk; i++) {
-				// Don't initialize chunk.
-				chunks[chunk_count][i].validator = 0xFFFFFFFF;
-				free_list_chunks[chunk_count][i] = alloc_count + i;
+	// Pushes the already linked elements from p_first to p_last.
+	void _push_free(FreeList &p_list, uint32_t p_first, uint32_t p_last) {
+		uint64_t head = p_list.head.load(std::memory_order_relaxed);
+		while (true) {
+			_get_next_free(p_last).store(uint32_t(head), std::memory_order_relaxed);
+			const uint64_t new_head = (((head >> 32) + 1) << 32) | (p_first + 1);
+			if constexpr (THREAD_SAFE) {
+				if (p_list.head.compare_exchange_weak(head, new_head, std::memory_order_release, std::memory_order_relaxed)) {
+					return;
+				}
+			} else {
+				p_list.head.store(new_head, std::memory_order_relaxed);
+				return;
 			}
+		}
+	}
 
-			max_alloc += elements_in_chunk;
+	// Adds a chunk, takes up to p_count of its elements and pushes the rest to p_list.
+	uint32_t _add_chunk(FreeList &p_list, uint32_t *r_indices, uint32_t p_count) {
+		uint32_t chunk_count = max_alloc.get() / elements_in_chunk;
+		if (THREAD_SAFE && chunk_count == chunk_limit) {
+			return 0;
 		}
 
-		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
+		//grow chunks
+		if constexpr (!THREAD_SAFE) {
+			chunks = (Chunk **)memrealloc(chunks, sizeof(Chunk *) * (chunk_count + 1));
+			free_list_chunks = (std::atomic<uint32_t> **)memrealloc(free_list_chunks, sizeof(std::atomic<uint32_t> *) * (chunk_count + 1));
+		}
+		Chunk *chunk = (Chunk *)memalloc(sizeof(Chunk) * elements_in_chunk); //but don't initialize
+		std::atomic<uint32_t> *next_free = (std::atomic<uint32_t> *)memalloc(sizeof(std::atomic<uint32_t>) * elements_in_chunk);
+
+		//initialize, linking each element to the next one
+		const uint32_t first = chunk_count * elements_in_chunk;
+		for (uint32_t i = 0; i < elements_in_chunk; i++) {
+			// Don't initialize the data.
+			memnew_placement(&chunk[i].validator, std::atomic<uint32_t>(0xFFFFFFFF));
+			memnew_placement(&next_free[i], std::atomic<uint32_t>(first + i + 2));
+		}
 
-		uint32_t free_chunk = free_index / elements_in_chunk;
-		uint32_t free_element = free_index % elements_in_chunk;
+		chunks[chunk_count] = chunk;
+		free_list_chunks[chunk_count] = next_free;
+		max_alloc.set(first + elements_in_chunk); // Publishes the chunk to readers.
 
-		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
-		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
-		uint64_t id = validator;
-		id <<= 32;
-		id |= free_index;
+		const uint32_t taken = MIN(p_count, elements_in_chunk);
+		for (uint32_t i = 0; i < taken; i++) {
+			r_indices[i] = first + i;
+		}
+		if (taken < elements_in_chunk) {
+			_push_free(p_list, first + taken, first + elements_in_chunk - 1);
+		}
+		return taken;
+	}
+
+	// Takes up to p_count free elements, adding chunks if needed. Returns fewer only when the element limit is reached.
+	uint32_t _take_free(uint32_t *r_indices, uint32_t p_count) {
+		const uint32_t home = THREAD_SAFE ? _get_thread_index() % FREE_LIST_COUNT : 0;
+		uint32_t taken = 0;
+		for (uint32_t i = 0; i < FREE_LIST_COUNT && taken < p_count; i++) {
+			FreeList &list = free_lists[(home + i) % FREE_LIST_COUNT];
+			while (taken < p_count) {
+				uint32_t popped = _pop_free(list, r_indices + taken, p_count - taken);
+				if (popped == 0) {
+					break;
+				}
+				taken += popped;
+			}
+		}
 
-		chunks[free_chunk][free_element].validator = validator;
-		chunks[free_chunk][free_element].validator |= 0x80000000; //mark uninitialized bit
+		while (taken < p_count) {
+			uint32_t added = 0;
+			if constexpr (THREAD_SAFE) {
+				MutexLock lock(mutex);
+				// Another thread may have added a chunk or freed elements in the meantime.
+				for (uint32_t i = 0; i < FREE_LIST_COUNT && added == 0; i++) {
+					added = _pop_free(free_lists[(home + i) % FREE_LIST_COUNT], r_indices + taken, p_count - taken);
+				}
+				if (added == 0) {
+					added = _add_chunk(free_lists[home], r_indices + taken, p_count - taken);
+				}
+			} else {
+				added = _add_chunk(free_lists[home], r_indices + taken, p_count - taken);
+			}
+			if (added == 0) {
+				break;
+			}
+			taken += added;
+		}
+		return taken;
+	}
 
-		alloc_count++;
+	// Validators also act as the generation of the element, they are never reused.
+	_FORCE_INLINE_ RID _make_allocated_rid(uint32_t p_index, uint64_t p_id) {
+		const uint32_t validator = uint32_t(p_id & 0x7FFFFFFF);
+		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
+		chunks[p_index / elements_in_chunk][p_index % elements_in_chunk].validator.store(validator | 0x80000000, std::memory_order_release); //mark uninitialized bit
+		return _make_from_id((uint64_t(validator) << 32) | p_index);
+	}
 
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
+	void _fail_limit_reached() {
+		if (description != nullptr) {
+			ERR_FAIL_MSG(vformat("Element limit for RID of type '%s' reached.", String(description)));
+		} else {
+			ERR_FAIL_MSG("Element limit reached.");
 		}
+	}
 
-		return _make_from_id(id);
+	_FORCE_INLINE_ RID _allocate_rid() {
+		uint32_t index = 0;
+		if (unlikely(_take_free(&index, 1) == 0)) {
+			_fail_limit_reached();
+			return RID();
+		}
+		alloc_count.increment();
+		return _make_allocated_rid(index, _gen_ids(1));
 	}
 
 public:
@@ -163,6 +269,47 @@ public:
 		return _allocate_rid();
 	}
 
+	// Allocates p_count RIDs at once, cheaper than allocating them one by one.
+	// They are not initialized, use initialize_rid afterwards. If the element limit is reached, the remaining ones are null.
+	void allocate_rids(RID *r_rids, uint32_t p_count) {
+		uint32_t indices[FREE_LIST_BATCH];
+		uint64_t validator = _gen_ids(p_count);
+		uint32_t done = 0;
+		while (done < p_count) {
+			const uint32_t batch = MIN(FREE_LIST_BATCH, p_count - done);
+			const uint32_t taken = _take_free(indices, batch);
+			alloc_count.add(taken);
+			for (uint32_t i = 0; i < taken; i++) {
+				r_rids[done + i] = _make_allocated_rid(indices[i], validator++);
+			}
+			done += taken;
+			if (unlikely(taken < batch)) {
+				for (uint32_t i = done; i < p_count; i++) {
+					r_rids[i] = RID();
+				}
+				_fail_limit_reached();
+				return;
+			}
+		}
+	}
+
+	void make_rids(RID *r_rids, uint32_t p_count) {
+		allocate_rids(r_rids, p_count);
+		for (uint32_t i = 0; i < p_count; i++) {
+			if (r_rids[i].is_valid()) {
+				initialize_rid(r_rids[i]);
+			}
+		}
+	}
+	void make_rids(RID *r_rids, uint32_t p_count, const T &p_value) {
+		allocate_rids(r_rids, p_count);
+		for (uint32_t i = 0; i < p_count; i++) {
+			if (r_rids[i].is_valid()) {
+				initialize_rid(r_rids[i], p_value);
+			}
+		}
+	}
+
 	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
 		if (p_rid == RID()) {
 			return nullptr;
@@ -170,7 +317,7 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
+		if (unlikely(idx >= max_alloc.get())) {
 			return nullptr;
 		}
 
@@ -180,19 +327,20 @@ public:
 		uint32_t validator = uint32_t(id >> 32);
 
 		Chunk &c = chunks[idx_chunk][idx_element];
+		uint32_t current = c.validator.load(std::memory_order_acquire);
 		if (unlikely(p_initialize)) {
-			if (unlikely(!(c.validator & 0x80000000))) {
+			if (unlikely(!(current & 0x80000000))) {
 				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
 			}
 
-			if (unlikely((c.validator & 0x7FFFFFFF) != validator)) {
+			if (unlikely((current & 0x7FFFFFFF) != validator)) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
 			}
 
-			c.validator &= 0x7FFFFFFF; //initialized
+			c.validator.store(current & 0x7FFFFFFF, std::memory_order_release); //initialized
 
-		} else if (unlikely(c.validator != validator)) {
-			if ((c.validator & 0x80000000) && c.validator != 0xFFFFFFFF) {
+		} else if (unlikely(current != validator)) {
+			if ((current & 0x80000000) && current != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
@@ -214,16 +362,9 @@ public:
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		if (unlikely(idx >= max_alloc.get())) {
 			return false;
 		}
 
@@ -232,26 +373,13 @@ public:
 
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (validator != 0x7FFFFFFF) && (chunks[idx_chunk][idx_element].validator & 0x7FFFFFFF) == validator;
-
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
-
-		return owned;
+		return (validator != 0x7FFFFFFF) && (chunks[idx_chunk][idx_element].validator.load(std::memory_order_acquire) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		if (unlikely(idx >= max_alloc.get())) {
 			ERR_FAIL();
 		}
 
@@ -259,64 +387,53 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(chunks[idx_chunk][idx_element].validator & 0x80000000)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		Chunk &c = chunks[idx_chunk][idx_element];
+		uint32_t current = c.validator.load(std::memory_order_acquire);
+		if (unlikely(current & 0x80000000)) {
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(chunks[idx_chunk][idx_element].validator != validator)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		} else if (unlikely(current != validator)) {
 			ERR_FAIL();
 		}
 
-		chunks[idx_chunk][idx_element].data.~T();
-		chunks[idx_chunk][idx_element].validator = 0xFFFFFFFF; // go invalid
-
-		alloc_count--;
-		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
-
 		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
+			// Invalidate first, so the same RID freed from two threads is only freed once.
+			if (unlikely(!c.validator.compare_exchange_strong(current, 0xFFFFFFFF, std::memory_order_acq_rel))) {
+				ERR_FAIL_MSG("Attempted to free a RID that is being freed by another thread");
+			}
+			c.data.~T();
+		} else {
+			c.data.~T();
+			c.validator.store(0xFFFFFFFF, std::memory_order_relaxed); // go invalid
 		}
+
+		alloc_count.decrement();
+		_push_free(free_lists[THREAD_SAFE ? _get_thread_index() % FREE_LIST_COUNT : 0], idx, idx);
 	}
 
 	_FORCE_INLINE_ uint32_t get_rid_count() const {
-		return alloc_count;
+		return alloc_count.get();
 	}
 	void get_owned_list(List<RID> *p_owned) const {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+		const uint32_t count = max_alloc.get();
+		for (size_t i = 0; i < count; i++) {
+			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator.load(std::memory_order_acquire);
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
 		}
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
 	}
 
 	//used for fast iteration in the elements or RIDs
 	void fill_owned_buffer(RID *p_rid_buffer) const {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+		const uint32_t count = max_alloc.get();
+		for (size_t i = 0; i < count; i++) {
+			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator.load(std::memory_order_acquire);
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
 			}
 		}
-
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
 	}
 
 	void set_description(const char *p_descrption) {
@@ -328,17 +445,18 @@ public:
 		if constexpr (THREAD_SAFE) {
 			chunk_limit = (p_maximum_number_of_elements / elements_in_chunk) + 1;
 			chunks = (Chunk **)memalloc(sizeof(Chunk *) * chunk_limit);
-			free_list_chunks = (uint32_t **)memalloc(sizeof(uint32_t *) * chunk_limit);
+			free_list_chunks = (std::atomic<uint32_t> **)memalloc(sizeof(std::atomic<uint32_t> *) * chunk_limit);
 		}
 	}
 
 	~RID_Alloc() {
-		if (alloc_count) {
+		const uint32_t count = max_alloc.get();
+		if (alloc_count.get()) {
 			print_error(vformat("ERROR: %d RID allocations of type '%s' were leaked at exit.",
-					alloc_count, description ? description : typeid(T).name()));
+					alloc_count.get(), description ? description : typeid(T).name()));
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+			for (size_t i = 0; i < count; i++) {
+				uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator.load(std::memory_order_relaxed);
 				if (validator & 0x80000000) {
 					continue; //uninitialized
 				}
@@ -348,7 +466,7 @@ public:
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		uint32_t chunk_count = count / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
 			memfree(chunks[i]);
 			memfree(free_list_chunks[i]);
@@ -374,6 +492,10 @@ public:
 		return alloc.allocate_rid();
 	}
 
+	_FORCE_INLINE_ void allocate_rids(RID *r_rids, uint32_t p_count) {
+		alloc.allocate_rids(r_rids, p_count);
+	}
+
 	_FORCE_INLINE_ void initialize_rid(RID p_rid, T *p_ptr) {
 		alloc.initialize_rid(p_rid, p_ptr);
 	}
@@ -436,6 +558,16 @@ public:
 		return alloc.allocate_rid();
 	}
 
+	_FORCE_INLINE_ void allocate_rids(RID *r_rids, uint32_t p_count) {
+		alloc.allocate_rids(r_rids, p_count);
+	}
+	_FORCE_INLINE_ void make_rids(RID *r_rids, uint32_t p_count) {
+		alloc.make_rids(r_rids, p_count);
+	}
+	_FORCE_INLINE_ void make_rids(RID *r_rids, uint32_t p_count, const T &p_value) {
+		alloc.make_rids(r_rids, p_count, p_value);
+	}
+
 	_FORCE_INLINE_ void initialize_rid(RID p_rid) {
 		alloc.initialize_rid(p_rid);
 	}
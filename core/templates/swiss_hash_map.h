@@ -0,0 +1,743 @@
+/**************************************************************************/
+/*  swiss_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SWISS_HASH_MAP_H
+#define SWISS_HASH_MAP_H
+
+#include "core/templates/hash_map.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWISS_HASH_MAP_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define SWISS_HASH_MAP_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * A hash map with the same API as HashMap, implemented as a "Swiss table":
+ * each slot of the table has a one-byte control value, holding 7 bits of the
+ * key hash (or the empty/deleted markers), and lookups compare a group of 16
+ * control bytes at once with SSE2 or NEON (with a scalar fallback). Only
+ * slots whose control byte matches need their key to be compared, so lookups
+ * rarely touch more than one cache line of metadata and one key.
+ *
+ * Like AHashMap, keys and values are stored in a dense array by insertion
+ * order, and the table only stores indices into it. Iteration is as fast as
+ * iterating a Vector. Erasing moves the last element into the erased place,
+ * so it does not preserve the insertion order, and pointers to elements are
+ * invalidated by any insertion or erasure.
+ *
+ * Elements are relocated with memcpy/realloc, the same as AHashMap.
+ *
+ * Use `find_as()`, `getptr_as()` and `has_as()` to look up with a different
+ * key type, which must hash to the same value with Hasher and be comparable
+ * to the keys with `==` (e.g. a String for StringName keys, which avoids
+ * interning the string).
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class SwissHashMap {
+public:
+	static constexpr uint32_t GROUP_WIDTH = 16;
+	// Must be a power of two, and at least GROUP_WIDTH.
+	static constexpr uint32_t INITIAL_CAPACITY = 16;
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	// Control bytes of full slots hold the lowest 7 bits of the hash, so they are never negative.
+	static constexpr int8_t CTRL_EMPTY = -128;
+	static constexpr int8_t CTRL_DELETED = -2;
+
+	// Each group match sets the bits at (byte index << MASK_SHIFT).
+	struct Group {
+#if defined(SWISS_HASH_MAP_SSE2)
+		static constexpr uint32_t MASK_SHIFT = 0;
+		__m128i ctrl;
+
+		_FORCE_INLINE_ explicit Group(const int8_t *p_ctrl) { ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl)); }
+		_FORCE_INLINE_ uint64_t match(int8_t p_h2) const { return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_h2), ctrl)); }
+		// Empty and deleted are the only negative control values.
+		_FORCE_INLINE_ uint64_t match_empty_or_deleted() const { return (uint32_t)_mm_movemask_epi8(ctrl); }
+#elif defined(SWISS_HASH_MAP_NEON)
+		static constexpr uint32_t MASK_SHIFT = 2;
+		int8x16_t ctrl;
+
+		// NEON has no movemask, narrow each byte of the comparison to a nibble and keep one bit of it.
+		static _FORCE_INLINE_ uint64_t _to_mask(uint8x16_t p_cmp) {
+			return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(p_cmp), 4)), 0) & 0x8888888888888888ull;
+		}
+		_FORCE_INLINE_ explicit Group(const int8_t *p_ctrl) { ctrl = vld1q_s8(p_ctrl); }
+		_FORCE_INLINE_ uint64_t match(int8_t p_h2) const { return _to_mask(vceqq_s8(vdupq_n_s8(p_h2), ctrl)); }
+		_FORCE_INLINE_ uint64_t match_empty_or_deleted() const { return _to_mask(vcltq_s8(ctrl, vdupq_n_s8(0))); }
+#else
+		static constexpr uint32_t MASK_SHIFT = 0;
+		const int8_t *ctrl;
+
+		_FORCE_INLINE_ explicit Group(const int8_t *p_ctrl) { ctrl = p_ctrl; }
+		_FORCE_INLINE_ uint64_t match(int8_t p_h2) const {
+			uint64_t mask = 0;
+			for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+				mask |= uint64_t(ctrl[i] == p_h2) << i;
+			}
+			return mask;
+		}
+		_FORCE_INLINE_ uint64_t match_empty_or_deleted() const {
+			uint64_t mask = 0;
+			for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+				mask |= uint64_t(ctrl[i] < 0) << i;
+			}
+			return mask;
+		}
+#endif
+		_FORCE_INLINE_ uint64_t match_empty() const { return match(CTRL_EMPTY); }
+	};
+
+	static _FORCE_INLINE_ uint32_t _mask_first(uint64_t p_mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+#if defined(_M_X64) || defined(_M_ARM64)
+		_BitScanForward64(&index, p_mask);
+#else
+		if (!_BitScanForward(&index, uint32_t(p_mask))) {
+			_BitScanForward(&index, uint32_t(p_mask >> 32));
+			index += 32;
+		}
+#endif
+		return uint32_t(index) >> Group::MASK_SHIFT;
+#else
+		return uint32_t(__builtin_ctzll(p_mask)) >> Group::MASK_SHIFT;
+#endif
+	}
+
+	MapKeyValue *elements = nullptr;
+	// capacity + GROUP_WIDTH bytes, the last GROUP_WIDTH bytes mirror the first ones so groups can be loaded at any slot.
+	int8_t *ctrl = nullptr;
+	// Index in elements of each full slot.
+	uint32_t *slots = nullptr;
+
+	// Number of slots, always a power of two.
+	uint32_t capacity = INITIAL_CAPACITY;
+	uint32_t num_elements = 0;
+	// Empty slots that may still be filled before the table must be rehashed. Inserting into an empty slot uses one,
+	// reusing a deleted slot doesn't. Erasing gives one back only when the slot can be marked empty again.
+	uint32_t growth_left = 0;
+
+	static _FORCE_INLINE_ uint32_t _get_max_elements(uint32_t p_capacity) {
+		return p_capacity - p_capacity / 8; // Maximum load factor of 7/8.
+	}
+
+	static _FORCE_INLINE_ uint32_t _h1(uint32_t p_hash) { return p_hash >> 7; }
+	static _FORCE_INLINE_ int8_t _h2(uint32_t p_hash) { return int8_t(p_hash & 0x7F); }
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_pos, int8_t p_value) {
+		ctrl[p_pos] = p_value;
+		if (p_pos < GROUP_WIDTH) {
+			ctrl[capacity + p_pos] = p_value;
+		}
+	}
+
+	// Probes groups with a triangular sequence, which visits every group once the table is full.
+	template <typename K, typename C>
+	_FORCE_INLINE_ bool _lookup_slot(const K &p_key, uint32_t p_hash, uint32_t &r_slot, C p_compare) const {
+		if (unlikely(elements == nullptr)) {
+			return false; // Failed lookups, no elements.
+		}
+
+		const uint32_t mask = capacity - 1;
+		const int8_t h2 = _h2(p_hash);
+		uint32_t pos = _h1(p_hash) & mask;
+		uint32_t stride = 0;
+		while (true) {
+			Group group(ctrl + pos);
+			uint64_t matches = group.match(h2);
+			while (matches) {
+				uint32_t slot = (pos + _mask_first(matches)) & mask;
+				if (likely(p_compare(elements[slots[slot]].key, p_key))) {
+					r_slot = slot;
+					return true;
+				}
+				matches &= matches - 1;
+			}
+			if (likely(group.match_empty())) {
+				return false;
+			}
+			stride += GROUP_WIDTH;
+			pos = (pos + stride) & mask;
+		}
+	}
+
+	_FORCE_INLINE_ bool _lookup_slot(const TKey &p_key, uint32_t p_hash, uint32_t &r_slot) const {
+		return _lookup_slot(p_key, p_hash, r_slot, [](const TKey &p_a, const TKey &p_b) { return Comparator::compare(p_a, p_b); });
+	}
+
+	_FORCE_INLINE_ bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, Hasher::hash(p_key), slot)) {
+			return false;
+		}
+		r_pos = slots[slot];
+		return true;
+	}
+
+	template <typename K>
+	_FORCE_INLINE_ bool _lookup_pos_as(const K &p_key, uint32_t &r_pos) const {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, Hasher::hash(p_key), slot, [](const TKey &p_a, const K &p_b) { return p_a == p_b; })) {
+			return false;
+		}
+		r_pos = slots[slot];
+		return true;
+	}
+
+	uint32_t _find_free_slot(uint32_t p_hash) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = _h1(p_hash) & mask;
+		uint32_t stride = 0;
+		while (true) {
+			uint64_t free = Group(ctrl + pos).match_empty_or_deleted();
+			if (free) {
+				return (pos + _mask_first(free)) & mask;
+			}
+			stride += GROUP_WIDTH;
+			pos = (pos + stride) & mask;
+		}
+	}
+
+	void _insert_with_hash(uint32_t p_hash, uint32_t p_index) {
+		uint32_t slot = _find_free_slot(p_hash);
+		if (ctrl[slot] == CTRL_EMPTY) {
+			growth_left--;
+		}
+		_set_ctrl(slot, _h2(p_hash));
+		slots[slot] = p_index;
+	}
+
+	void _allocate_table() {
+		ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(capacity + GROUP_WIDTH));
+		slots = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity));
+		memset(ctrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+		growth_left = _get_max_elements(capacity);
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		Memory::free_static(ctrl);
+		Memory::free_static(slots);
+
+		capacity = MAX(INITIAL_CAPACITY, next_power_of_2(p_new_capacity));
+		_allocate_table();
+		elements = reinterpret_cast<MapKeyValue *>(Memory::realloc_static(elements, sizeof(MapKeyValue) * _get_max_elements(capacity)));
+
+		for (uint32_t i = 0; i < num_elements; i++) {
+			_insert_with_hash(Hasher::hash(elements[i].key), i);
+		}
+	}
+
+	uint32_t _insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(elements == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate_table();
+			elements = reinterpret_cast<MapKeyValue *>(Memory::alloc_static(sizeof(MapKeyValue) * _get_max_elements(capacity)));
+		}
+
+		if (unlikely(growth_left == 0)) {
+			// Rehash at the same size to drop the deleted slots if there is still enough room after that.
+			bool grow = uint64_t(num_elements) * 32 > uint64_t(capacity) * 25;
+			_resize_and_rehash(grow ? capacity * 2 : capacity);
+		}
+
+		memnew_placement(&elements[num_elements], MapKeyValue(p_key, p_value));
+
+		_insert_with_hash(p_hash, num_elements);
+		num_elements++;
+		return num_elements - 1;
+	}
+
+	void _erase_slot(uint32_t p_slot) {
+		// A slot can be marked empty again only if every group containing it already had an empty slot,
+		// otherwise a probe could stop early at it. Count the full or deleted slots around it.
+		const uint32_t mask = capacity - 1;
+		uint32_t before = 0;
+		while (before < GROUP_WIDTH && ctrl[(p_slot - before - 1) & mask] != CTRL_EMPTY) {
+			before++;
+		}
+		uint32_t after = 0;
+		while (after < GROUP_WIDTH && ctrl[(p_slot + after + 1) & mask] != CTRL_EMPTY) {
+			after++;
+		}
+
+		if (before + after + 1 < GROUP_WIDTH) {
+			_set_ctrl(p_slot, CTRL_EMPTY);
+			growth_left++;
+		} else {
+			_set_ctrl(p_slot, CTRL_DELETED);
+		}
+
+		uint32_t element_pos = slots[p_slot];
+		elements[element_pos].key.~TKey();
+		elements[element_pos].value.~TValue();
+		num_elements--;
+
+		if (element_pos < num_elements) {
+			// Move the last element into the hole, and point its slot to the new place.
+			uint32_t last_slot = 0;
+			_lookup_slot(elements[num_elements].key, Hasher::hash(elements[num_elements].key), last_slot);
+			void *destination = &elements[element_pos];
+			const void *source = &elements[num_elements];
+			memcpy(destination, source, sizeof(MapKeyValue));
+			slots[last_slot] = element_pos;
+		}
+	}
+
+	void _init_from(const SwissHashMap &p_other) {
+		capacity = p_other.capacity;
+		num_elements = p_other.num_elements;
+
+		if (p_other.elements == nullptr) {
+			return;
+		}
+
+		ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(capacity + GROUP_WIDTH));
+		slots = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity));
+		elements = reinterpret_cast<MapKeyValue *>(Memory::alloc_static(sizeof(MapKeyValue) * _get_max_elements(capacity)));
+		growth_left = p_other.growth_left;
+
+		if constexpr (std::is_trivially_copyable_v<TKey> && std::is_trivially_copyable_v<TValue>) {
+			void *destination = elements;
+			const void *source = p_other.elements;
+			memcpy(destination, source, sizeof(MapKeyValue) * num_elements);
+		} else {
+			for (uint32_t i = 0; i < num_elements; i++) {
+				memnew_placement(&elements[i], MapKeyValue(p_other.elements[i]));
+			}
+		}
+
+		memcpy(ctrl, p_other.ctrl, capacity + GROUP_WIDTH);
+		memcpy(slots, p_other.slots, sizeof(uint32_t) * capacity);
+	}
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (elements == nullptr || num_elements == 0) {
+			return;
+		}
+
+		memset(ctrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+		growth_left = _get_max_elements(capacity);
+		if constexpr (!(std::is_trivially_destructible_v<TKey> && std::is_trivially_destructible_v<TValue>)) {
+			for (uint32_t i = 0; i < num_elements; i++) {
+				elements[i].key.~TKey();
+				elements[i].value.~TValue();
+			}
+		}
+
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "SwissHashMap key not found.");
+		return elements[pos].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "SwissHashMap key not found.");
+		return elements[pos].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &elements[pos].value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &elements[pos].value;
+		}
+		return nullptr;
+	}
+
+	template <typename K>
+	const TValue *getptr_as(const K &p_key) const {
+		uint32_t pos = 0;
+		if (_lookup_pos_as(p_key, pos)) {
+			return &elements[pos].value;
+		}
+		return nullptr;
+	}
+
+	template <typename K>
+	TValue *getptr_as(const K &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos_as(p_key, pos)) {
+			return &elements[pos].value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t pos = 0;
+		return _lookup_pos(p_key, pos);
+	}
+
+	template <typename K>
+	_FORCE_INLINE_ bool has_as(const K &p_key) const {
+		uint32_t pos = 0;
+		return _lookup_pos_as(p_key, pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, Hasher::hash(p_key), slot)) {
+			return false;
+		}
+		_erase_slot(slot);
+		return true;
+	}
+
+	// Replace the key of an entry in-place, without invalidating iterators or changing the entries position during iteration.
+	// p_old_key must exist in the map and p_new_key must not, unless it is equal to p_old_key.
+	bool replace_key(const TKey &p_old_key, const TKey &p_new_key) {
+		if (p_old_key == p_new_key) {
+			return true;
+		}
+		uint32_t slot = 0;
+		ERR_FAIL_COND_V(_lookup_slot(p_new_key, Hasher::hash(p_new_key), slot), false);
+		ERR_FAIL_COND_V(!_lookup_slot(p_old_key, Hasher::hash(p_old_key), slot), false);
+
+		uint32_t element_pos = slots[slot];
+		_set_ctrl(slot, CTRL_DELETED);
+		const_cast<TKey &>(elements[element_pos].key) = p_new_key;
+		if (unlikely(growth_left == 0)) {
+			_resize_and_rehash(capacity); // Also reinserts the element with its new key.
+		} else {
+			_insert_with_hash(Hasher::hash(p_new_key), element_pos);
+		}
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = capacity;
+		while (_get_max_elements(new_capacity) < p_new_capacity) {
+			new_capacity *= 2;
+		}
+		if (new_capacity == capacity) {
+			return;
+		}
+		if (elements == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return *pair;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return pair;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			pair++;
+			return *this;
+		}
+
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			pair--;
+			if (pair < begin) {
+				pair = end;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return pair == b.pair; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return pair != b.pair; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return pair != end;
+		}
+
+		_FORCE_INLINE_ ConstIterator(MapKeyValue *p_key, MapKeyValue *p_begin, MapKeyValue *p_end) {
+			pair = p_key;
+			begin = p_begin;
+			end = p_end;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		MapKeyValue *pair = nullptr;
+		MapKeyValue *begin = nullptr;
+		MapKeyValue *end = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return *pair;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return pair;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			pair++;
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			pair--;
+			if (pair < begin) {
+				pair = end;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pair == b.pair; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pair != b.pair; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return pair != end;
+		}
+
+		_FORCE_INLINE_ Iterator(MapKeyValue *p_key, MapKeyValue *p_begin, MapKeyValue *p_end) {
+			pair = p_key;
+			begin = p_begin;
+			end = p_end;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(pair, begin, end);
+		}
+
+	private:
+		MapKeyValue *pair = nullptr;
+		MapKeyValue *begin = nullptr;
+		MapKeyValue *end = nullptr;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(elements, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(elements + num_elements, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		if (unlikely(num_elements == 0)) {
+			return Iterator(nullptr, nullptr, nullptr);
+		}
+		return Iterator(elements + num_elements - 1, elements, elements + num_elements);
+	}
+
+	Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(elements + pos, elements, elements + num_elements);
+	}
+
+	template <typename K>
+	Iterator find_as(const K &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos_as(p_key, pos)) {
+			return end();
+		}
+		return Iterator(elements + pos, elements, elements + num_elements);
+	}
+
+	void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(elements, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(elements + num_elements, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		if (unlikely(num_elements == 0)) {
+			return ConstIterator(nullptr, nullptr, nullptr);
+		}
+		return ConstIterator(elements + num_elements - 1, elements, elements + num_elements);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return ConstIterator(elements + pos, elements, elements + num_elements);
+	}
+
+	template <typename K>
+	ConstIterator find_as(const K &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos_as(p_key, pos)) {
+			return end();
+		}
+		return ConstIterator(elements + pos, elements, elements + num_elements);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return elements[pos].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t hash = Hasher::hash(p_key);
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, hash, slot)) {
+			return elements[slots[slot]].value;
+		}
+		uint32_t pos = _insert_element(p_key, TValue(), hash);
+		return elements[pos].value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t hash = Hasher::hash(p_key);
+		uint32_t slot = 0;
+		uint32_t pos = 0;
+		if (_lookup_slot(p_key, hash, slot)) {
+			pos = slots[slot];
+			elements[pos].value = p_value;
+		} else {
+			pos = _insert_element(p_key, p_value, hash);
+		}
+		return Iterator(elements + pos, elements, elements + num_elements);
+	}
+
+	// Inserts an element without checking if it already exists.
+	Iterator insert_new(const TKey &p_key, const TValue &p_value) {
+		DEV_ASSERT(!has(p_key));
+		uint32_t pos = _insert_element(p_key, p_value, Hasher::hash(p_key));
+		return Iterator(elements + pos, elements, elements + num_elements);
+	}
+
+	/* Constructors */
+
+	SwissHashMap(const SwissHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	SwissHashMap(const HashMap<TKey, TValue, Hasher, Comparator> &p_other) {
+		reserve(p_other.size());
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert_element(E.key, E.value, Hasher::hash(E.key));
+		}
+	}
+
+	void operator=(const SwissHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+
+		_init_from(p_other);
+	}
+
+	SwissHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	SwissHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	SwissHashMap() {}
+
+	void reset() {
+		if (elements != nullptr) {
+			if constexpr (!(std::is_trivially_destructible_v<TKey> && std::is_trivially_destructible_v<TValue>)) {
+				for (uint32_t i = 0; i < num_elements; i++) {
+					elements[i].key.~TKey();
+					elements[i].value.~TValue();
+				}
+			}
+			Memory::free_static(elements);
+			Memory::free_static(ctrl);
+			Memory::free_static(slots);
+			elements = nullptr;
+			ctrl = nullptr;
+			slots = nullptr;
+		}
+		capacity = INITIAL_CAPACITY;
+		num_elements = 0;
+		growth_left = 0;
+	}
+
+	~SwissHashMap() {
+		reset();
+	}
+};
+
+extern template class SwissHashMap<int, int>;
+extern template class SwissHashMap<String, int>;
+extern template class SwissHashMap<StringName, int>;
+extern template class SwissHashMap<StringName, Variant>;
+
+#endif // SWISS_HASH_MAP_H
@@ -30,7 +30,7 @@
 
 #include "dictionary.h"
 
-#include "core/templates/hash_map.h"
+#include "core/templates/ordered_hash_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/container_type_validate.h"
 #include "core/variant/variant.h"
@@ -43,10 +43,38 @@
 struct DictionaryPrivate {
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
 	ContainerTypeValidate typed_key;
 	ContainerTypeValidate typed_value;
 	Variant *typed_fallback = nullptr; // Allows a typed dictionary to return dummy values when attempting an invalid access.
+
+	// Typed dictionaries with simple keys skip the generic Variant hashing.
+	// This must give the same result as Variant::recursive_hash(), as the stored hashes are kept when copying between dictionaries.
+	_FORCE_INLINE_ uint32_t hash_key(const Variant &p_key) const {
+		if (p_key.get_type() == typed_key.type) {
+			switch (typed_key.type) {
+				case Variant::BOOL:
+					return *VariantInternal::get_bool(&p_key) ? 1 : 0;
+				case Variant::INT:
+					return hash_one_uint64((uint64_t)*VariantInternal::get_int(&p_key));
+				case Variant::FLOAT:
+					return hash_murmur3_one_double(*VariantInternal::get_float(&p_key));
+				case Variant::STRING:
+					return VariantInternal::get_string(&p_key)->hash();
+				case Variant::STRING_NAME:
+					return VariantInternal::get_string_name(&p_key)->hash();
+				case Variant::VECTOR2I:
+					return HashMapHasherDefault::hash(*VariantInternal::get_vector2i(&p_key));
+				case Variant::VECTOR3I:
+					return HashMapHasherDefault::hash(*VariantInternal::get_vector3i(&p_key));
+				case Variant::RID:
+					return hash_one_uint64(VariantInternal::get_rid(&p_key)->get_id());
+				default:
+					break;
+			}
+		}
+		return VariantHasher::hash(p_key);
+	}
 };
 
 void Dictionary::get_key_list(List<Variant> *p_keys) const {
@@ -60,27 +88,17 @@ void Dictionary::get_key_list(List<Variant> *p_keys) const {
 }
 
 Variant Dictionary::get_key_at_index(int p_index) const {
-	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-		if (index == p_index) {
-			return E.key;
-		}
-		index++;
+	if (p_index < 0 || p_index >= (int)_p->variant_map.size()) {
+		return Variant();
 	}
-
-	return Variant();
+	return _p->variant_map.get_by_index(p_index).key;
 }
 
 Variant Dictionary::get_value_at_index(int p_index) const {
-	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-		if (index == p_index) {
-			return E.value;
-		}
-		index++;
+	if (p_index < 0 || p_index >= (int)_p->variant_map.size()) {
+		return Variant();
 	}
-
-	return Variant();
+	return _p->variant_map.get_by_index(p_index).value;
 }
 
 // WARNING: This operator does not validate the value type. For scripting/extensions this is
@@ -94,17 +112,21 @@ Variant &Dictionary::operator[](const Variant &p_key) {
 		VariantInternal::initialize(_p->typed_fallback, _p->typed_value.type);
 		return *_p->typed_fallback;
 	} else if (unlikely(_p->read_only)) {
-		if (likely(_p->variant_map.has(key))) {
-			*_p->read_only = _p->variant_map[key];
+		const Variant *value = _p->variant_map.getptr(key, _p->hash_key(key));
+		if (likely(value)) {
+			*_p->read_only = *value;
 		} else {
 			VariantInternal::initialize(_p->read_only, _p->typed_value.type);
 		}
 		return *_p->read_only;
 	} else {
-		if (unlikely(!_p->variant_map.has(key))) {
-			VariantInternal::initialize(&_p->variant_map[key], _p->typed_value.type);
+		const uint32_t hash = _p->hash_key(key);
+		Variant *value = _p->variant_map.getptr(key, hash);
+		if (unlikely(!value)) {
+			value = &_p->variant_map.insert(key, Variant(), hash)->value;
+			VariantInternal::initialize(value, _p->typed_value.type);
 		}
-		return _p->variant_map[key];
+		return *value;
 	}
 }
 
@@ -118,7 +140,9 @@ const Variant &Dictionary::operator[](const Variant &p_key) const {
 		return *_p->typed_fallback;
 	} else {
 		// Will not insert key, so no initialization is necessary.
-		return _p->variant_map[key];
+		const Variant *value = _p->variant_map.getptr(key, _p->hash_key(key));
+		CRASH_COND(!value);
+		return *value;
 	}
 }
 
@@ -127,7 +151,7 @@ const Variant *Dictionary::getptr(const Variant &p_key) const {
 	if (unlikely(!_p->typed_key.validate(key, "getptr"))) {
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key, _p->hash_key(key)));
 	if (!E) {
 		return nullptr;
 	}
@@ -140,7 +164,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 	if (unlikely(!_p->typed_key.validate(key, "getptr"))) {
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(key));
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(key, _p->hash_key(key)));
 	if (!E) {
 		return nullptr;
 	}
@@ -155,7 +179,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 Variant Dictionary::get_valid(const Variant &p_key) const {
 	Variant key = p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "get_valid"), Variant());
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key, _p->hash_key(key)));
 
 	if (!E) {
 		return Variant();
@@ -193,7 +217,7 @@ bool Dictionary::set(const Variant &p_key, const Variant &p_value) {
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "set"), false);
 	Variant value = p_value;
 	ERR_FAIL_COND_V(!_p->typed_value.validate(value, "set"), false);
-	_p->variant_map[key] = value;
+	_p->variant_map.insert(key, value, _p->hash_key(key));
 	return true;
 }
 
@@ -208,7 +232,7 @@ bool Dictionary::is_empty() const {
 bool Dictionary::has(const Variant &p_key) const {
 	Variant key = p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "use 'has'"), false);
-	return _p->variant_map.has(p_key);
+	return _p->variant_map.has(p_key, _p->hash_key(p_key));
 }
 
 bool Dictionary::has_all(const Array &p_keys) const {
@@ -237,7 +261,7 @@ bool Dictionary::erase(const Variant &p_key) {
 	Variant key = p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "erase"), false);
 	ERR_FAIL_COND_V_MSG(_p->read_only, false, "Dictionary is in read-only state.");
-	return _p->variant_map.erase(key);
+	return _p->variant_map.erase(key, _p->hash_key(key));
 }
 
 bool Dictionary::operator==(const Dictionary &p_dictionary) const {
@@ -264,7 +288,7 @@ bool Dictionary::recursive_equal(const Dictionary &p_dictionary, int recursion_c
 	}
 	recursion_count++;
 	for (const KeyValue<Variant, Variant> &this_E : _p->variant_map) {
-		HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key));
+		OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key, p_dictionary._p->hash_key(this_E.key)));
 		if (!other_E || !this_E.value.hash_compare(other_E->value, recursion_count, false)) {
 			return false;
 		}
@@ -410,7 +434,7 @@ void Dictionary::assign(const Dictionary &p_dictionary) {
 	}
 
 	int size = p_dictionary._p->variant_map.size();
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map = HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>(size);
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map = OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>(size);
 
 	Vector<Variant> key_array;
 	key_array.resize(size);
@@ -527,7 +551,7 @@ void Dictionary::assign(const Dictionary &p_dictionary) {
 	}
 
 	for (int i = 0; i < size; i++) {
-		variant_map.insert(key_data[i], value_data[i]);
+		variant_map.insert(key_data[i], value_data[i], _p->hash_key(key_data[i]));
 	}
 
 	_p->variant_map = variant_map;
@@ -543,7 +567,7 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 	}
 	Variant key = *p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "next"), nullptr);
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(key);
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(key, _p->hash_key(key));
 
 	if (!E) {
 		return nullptr;
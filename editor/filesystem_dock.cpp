@@ -1668,8 +1668,9 @@ void FileSystemDock::_update_project_settings_after_move(const HashMap<String, S
 	// Update folder colors.
 	for (const KeyValue<String, String> &rename : p_folders_renames) {
 		if (assigned_folder_colors.has(rename.key)) {
-			assigned_folder_colors[rename.value] = assigned_folder_colors[rename.key];
+			Variant color = assigned_folder_colors[rename.key];
 			assigned_folder_colors.erase(rename.key);
+			assigned_folder_colors[rename.value] = color;
 		}
 	}
 	ProjectSettings::get_singleton()->save();
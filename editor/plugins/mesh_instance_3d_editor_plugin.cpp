@@ -48,6 +48,7 @@
 #include "scene/resources/3d/concave_polygon_shape_3d.h"
 #include "scene/resources/3d/convex_polygon_shape_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
+#include "scene/resources/surface_tool.h"
 
 void MeshInstance3DEditor::_node_removed(Node *p_node) {
 	if (p_node == node) {
@@ -221,6 +222,9 @@ void MeshInstance3DEditor::_menu_option(int p_option) {
 		case MENU_OPTION_CREATE_OUTLINE_MESH: {
 			outline_dialog->popup_centered(Vector2(200, 90));
 		} break;
+		case MENU_OPTION_CREATE_HLOD_PROXY: {
+			hlod_dialog->popup_centered(Vector2(200, 90));
+		} break;
 		case MENU_OPTION_CREATE_DEBUG_TANGENTS: {
 			EditorUndoRedoManager *ur = EditorUndoRedoManager::get_singleton();
 			ur->create_action(TTR("Create Debug Tangents"));
@@ -558,6 +562,196 @@ void MeshInstance3DEditor::_create_outline_mesh() {
 	ur->commit_action();
 }
 
+void MeshInstance3DEditor::_create_hlod_proxy() {
+	Node *parent = node->get_parent();
+	Node3D *parent_3d = Object::cast_to<Node3D>(parent);
+	if (!parent || node == get_tree()->get_edited_scene_root()) {
+		err_dialog->set_text(TTR("Can't create an HLOD proxy as sibling for the scene root."));
+		err_dialog->popup_centered();
+		return;
+	}
+
+	List<Node *> selection = EditorNode::get_singleton()->get_editor_selection()->get_selected_node_list();
+	if (selection.is_empty()) {
+		selection.push_back(node);
+	}
+
+	// Merge every triangle surface of the selected instances into one surface per material,
+	// in the space of the proxy (which is placed at the origin of the edited node's parent).
+	struct ProxySurface {
+		Ref<Material> material;
+		Vector<Vector3> vertices;
+		Vector<Vector3> normals;
+		Vector<Vector2> uvs;
+		LocalVector<uint32_t> indices;
+		bool has_normals = true;
+		bool has_uvs = true;
+	};
+	LocalVector<ProxySurface> surfaces;
+	LocalVector<MeshInstance3D *> sources;
+
+	Transform3D parent_inverse = parent_3d ? parent_3d->get_global_transform().affine_inverse() : Transform3D();
+	for (Node *E : selection) {
+		MeshInstance3D *instance = Object::cast_to<MeshInstance3D>(E);
+		if (!instance || instance->get_parent() != parent || instance->get_mesh().is_null()) {
+			continue;
+		}
+
+		Ref<Mesh> mesh = instance->get_mesh();
+		Transform3D xform = parent_inverse * instance->get_global_transform();
+		Basis normal_basis = xform.basis.inverse().transposed();
+		for (int i = 0; i < mesh->get_surface_count(); i++) {
+			if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
+				continue;
+			}
+
+			Ref<Material> material = instance->get_active_material(i);
+			ProxySurface *surface = nullptr;
+			for (ProxySurface &S : surfaces) {
+				if (S.material == material) {
+					surface = &S;
+					break;
+				}
+			}
+			if (!surface) {
+				surfaces.push_back(ProxySurface());
+				surface = &surfaces[surfaces.size() - 1];
+				surface->material = material;
+			}
+
+			Array arrays = mesh->surface_get_arrays(i);
+			Vector<Vector3> vertices = arrays[Mesh::ARRAY_VERTEX];
+			Vector<Vector3> normals = arrays[Mesh::ARRAY_NORMAL];
+			Vector<Vector2> uvs = arrays[Mesh::ARRAY_TEX_UV];
+			Vector<int> indices = arrays[Mesh::ARRAY_INDEX];
+
+			uint32_t base = surface->vertices.size();
+			for (const Vector3 &vertex : vertices) {
+				surface->vertices.push_back(xform.xform(vertex));
+			}
+			surface->has_normals = surface->has_normals && normals.size() == vertices.size();
+			if (surface->has_normals) {
+				for (const Vector3 &normal : normals) {
+					surface->normals.push_back(normal_basis.xform(normal).normalized());
+				}
+			}
+			surface->has_uvs = surface->has_uvs && uvs.size() == vertices.size();
+			if (surface->has_uvs) {
+				surface->uvs.append_array(uvs);
+			}
+			if (indices.is_empty()) {
+				for (int j = 0; j < vertices.size(); j++) {
+					surface->indices.push_back(base + j);
+				}
+			} else {
+				for (int index : indices) {
+					surface->indices.push_back(base + index);
+				}
+			}
+		}
+
+		sources.push_back(instance);
+	}
+
+	if (surfaces.is_empty()) {
+		err_dialog->set_text(TTR("The selected MeshInstance3D nodes have no triangle surfaces to merge."));
+		err_dialog->popup_centered();
+		return;
+	}
+
+	Ref<ArrayMesh> proxy_mesh;
+	proxy_mesh.instantiate();
+	float triangle_ratio = hlod_triangle_ratio->get_value();
+	for (ProxySurface &surface : surfaces) {
+		uint32_t index_count = surface.indices.size();
+		if (SurfaceTool::simplify_func && triangle_ratio < 1.0) {
+			LocalVector<float> positions;
+			positions.resize(surface.vertices.size() * 3);
+			for (int i = 0; i < surface.vertices.size(); i++) {
+				positions[i * 3 + 0] = surface.vertices[i].x;
+				positions[i * 3 + 1] = surface.vertices[i].y;
+				positions[i * 3 + 2] = surface.vertices[i].z;
+			}
+
+			LocalVector<uint32_t> simplified;
+			simplified.resize(index_count);
+			size_t target_index_count = MAX(size_t(index_count * triangle_ratio) / 3 * 3, size_t(3));
+			float error = 0.0;
+			index_count = SurfaceTool::simplify_func(simplified.ptr(), surface.indices.ptr(), index_count, positions.ptr(), surface.vertices.size(), sizeof(float) * 3, target_index_count, 0.05, SurfaceTool::SIMPLIFY_PRUNE, &error);
+			surface.indices = simplified;
+		}
+		if (index_count == 0) {
+			continue;
+		}
+
+		// Only keep the vertices still referenced after simplification.
+		LocalVector<int> remap;
+		remap.resize(surface.vertices.size());
+		for (int &index : remap) {
+			index = -1;
+		}
+		Vector<Vector3> vertices;
+		Vector<Vector3> normals;
+		Vector<Vector2> uvs;
+		Vector<int> indices;
+		indices.resize(index_count);
+		for (uint32_t i = 0; i < index_count; i++) {
+			uint32_t vertex = surface.indices[i];
+			if (remap[vertex] < 0) {
+				remap[vertex] = vertices.size();
+				vertices.push_back(surface.vertices[vertex]);
+				if (surface.has_normals) {
+					normals.push_back(surface.normals[vertex]);
+				}
+				if (surface.has_uvs) {
+					uvs.push_back(surface.uvs[vertex]);
+				}
+			}
+			indices.write[i] = remap[vertex];
+		}
+
+		Array arrays;
+		arrays.resize(Mesh::ARRAY_MAX);
+		arrays[Mesh::ARRAY_VERTEX] = vertices;
+		if (surface.has_normals) {
+			arrays[Mesh::ARRAY_NORMAL] = normals;
+		}
+		if (surface.has_uvs) {
+			arrays[Mesh::ARRAY_TEX_UV] = uvs;
+		}
+		arrays[Mesh::ARRAY_INDEX] = indices;
+		proxy_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+		proxy_mesh->surface_set_material(proxy_mesh->get_surface_count() - 1, surface.material);
+	}
+
+	String proxy_name = "HLODProxy";
+	for (int i = 2; parent->has_node(NodePath(proxy_name)); i++) {
+		proxy_name = "HLODProxy" + itos(i);
+	}
+
+	// The proxy shows up past the switch distance, and the merged instances are hidden
+	// whenever it is visible by making it their visibility parent.
+	MeshInstance3D *proxy = memnew(MeshInstance3D);
+	proxy->set_name(proxy_name);
+	proxy->set_mesh(proxy_mesh);
+	proxy->set_visibility_range_begin(hlod_distance->get_value());
+
+	Node *owner = get_tree()->get_edited_scene_root();
+	EditorUndoRedoManager *ur = EditorUndoRedoManager::get_singleton();
+	ur->create_action(TTR("Create HLOD Proxy"));
+
+	ur->add_do_method(parent, "add_child", proxy, true);
+	ur->add_do_method(proxy, "set_owner", owner);
+	ur->add_do_method(Node3DEditor::get_singleton(), SceneStringName(_request_gizmo), proxy);
+	for (MeshInstance3D *source : sources) {
+		ur->add_do_method(source, "set_visibility_parent", NodePath("../" + proxy_name));
+		ur->add_undo_method(source, "set_visibility_parent", source->get_visibility_parent());
+	}
+	ur->add_do_reference(proxy);
+	ur->add_undo_method(parent, "remove_child", proxy);
+	ur->commit_action();
+}
+
 void MeshInstance3DEditor::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_THEME_CHANGED: {
@@ -577,6 +771,8 @@ MeshInstance3DEditor::MeshInstance3DEditor() {
 	options->get_popup()->add_separator();
 	options->get_popup()->add_item(TTR("Create Outline Mesh..."), MENU_OPTION_CREATE_OUTLINE_MESH);
 	options->get_popup()->set_item_tooltip(options->get_popup()->get_item_count() - 1, TTR("Creates a static outline mesh. The outline mesh will have its normals flipped automatically.\nThis can be used instead of the StandardMaterial Grow property when using that property isn't possible."));
+	options->get_popup()->add_item(TTR("Create HLOD Proxy..."), MENU_OPTION_CREATE_HLOD_PROXY);
+	options->get_popup()->set_item_tooltip(options->get_popup()->get_item_count() - 1, TTR("Merges the selected sibling MeshInstance3D nodes into a single simplified proxy mesh.\nThe proxy replaces them past the switch distance, so distant clusters cost a single draw per material."));
 	options->get_popup()->add_item(TTR("Create Debug Tangents"), MENU_OPTION_CREATE_DEBUG_TANGENTS);
 	options->get_popup()->add_separator();
 	options->get_popup()->add_item(TTR("View UV1"), MENU_OPTION_DEBUG_UV1);
@@ -603,6 +799,31 @@ MeshInstance3DEditor::MeshInstance3DEditor() {
 	add_child(outline_dialog);
 	outline_dialog->connect(SceneStringName(confirmed), callable_mp(this, &MeshInstance3DEditor::_create_outline_mesh));
 
+	hlod_dialog = memnew(ConfirmationDialog);
+	hlod_dialog->set_title(TTR("Create HLOD Proxy"));
+	hlod_dialog->set_ok_button_text(TTR("Create"));
+
+	VBoxContainer *hlod_dialog_vbc = memnew(VBoxContainer);
+	hlod_dialog->add_child(hlod_dialog_vbc);
+
+	hlod_triangle_ratio = memnew(SpinBox);
+	hlod_triangle_ratio->set_min(0.01);
+	hlod_triangle_ratio->set_max(1.0);
+	hlod_triangle_ratio->set_step(0.01);
+	hlod_triangle_ratio->set_value(0.25);
+	hlod_dialog_vbc->add_margin_child(TTR("Triangle Ratio:"), hlod_triangle_ratio);
+
+	hlod_distance = memnew(SpinBox);
+	hlod_distance->set_min(0.0);
+	hlod_distance->set_max(100000.0);
+	hlod_distance->set_step(0.01);
+	hlod_distance->set_value(100.0);
+	hlod_distance->set_suffix("m");
+	hlod_dialog_vbc->add_margin_child(TTR("Switch Distance:"), hlod_distance);
+
+	add_child(hlod_dialog);
+	hlod_dialog->connect(SceneStringName(confirmed), callable_mp(this, &MeshInstance3DEditor::_create_hlod_proxy));
+
 	shape_dialog = memnew(ConfirmationDialog);
 	shape_dialog->set_title(TTR("Create Collision Shape"));
 	shape_dialog->set_ok_button_text(TTR("Create"));
@@ -48,6 +48,7 @@ class MeshInstance3DEditor : public Control {
 		MENU_OPTION_CREATE_COLLISION_SHAPE,
 		MENU_OPTION_CREATE_NAVMESH,
 		MENU_OPTION_CREATE_OUTLINE_MESH,
+		MENU_OPTION_CREATE_HLOD_PROXY,
 		MENU_OPTION_CREATE_DEBUG_TANGENTS,
 		MENU_OPTION_CREATE_UV2,
 		MENU_OPTION_DEBUG_UV1,
@@ -73,6 +74,10 @@ class MeshInstance3DEditor : public Control {
 	ConfirmationDialog *outline_dialog = nullptr;
 	SpinBox *outline_size = nullptr;
 
+	ConfirmationDialog *hlod_dialog = nullptr;
+	SpinBox *hlod_triangle_ratio = nullptr;
+	SpinBox *hlod_distance = nullptr;
+
 	ConfirmationDialog *shape_dialog = nullptr;
 	OptionButton *shape_type = nullptr;
 	OptionButton *shape_placement = nullptr;
@@ -90,6 +95,7 @@ class MeshInstance3DEditor : public Control {
 	Vector<Ref<Shape3D>> create_shape_from_mesh(Ref<Mesh> p_mesh, int p_option, bool p_verbose);
 	void _menu_option(int p_option);
 	void _create_outline_mesh();
+	void _create_hlod_proxy();
 	void _create_navigation_mesh();
 
 	void _create_uv_lines(int p_layer);
@@ -56,6 +56,7 @@
 #include "main/app_icon.gen.h"
 #include "main/main_timer_sync.h"
 #include "main/performance.h"
+#include "main/rendering_benchmark.h"
 #include "main/splash.gen.h"
 #include "modules/register_module_types.h"
 #include "platform/register_platform_apis.h"
@@ -247,6 +248,7 @@ static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+static bool benchmark_rendering = false;
 #ifdef TOOLS_ENABLED
 static bool editor_pseudolocalization = false;
 static bool dump_gdextension_interface = false;
@@ -696,6 +698,8 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("", "If incompatibilities or errors are detected, the exit code will be non-zero.\n");
 	print_help_option("--benchmark", "Benchmark the run time and print it to console.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("--benchmark-file <path>", "Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n", CLI_OPTION_AVAILABILITY_EDITOR);
+	print_help_option("--benchmark-rendering", "Run a built-in scene suite, print the average CPU time of each rendering stage and quit. Use --benchmark-file to also save the results in JSON format.\n");
+	print_help_option("", "Works with --headless (dummy renderer) or a software Vulkan driver, so it can run on machines without a GPU.\n");
 #ifdef TESTS_ENABLED
 	print_help_option("--test [--help]", "Run unit tests. Use --test --help for more information.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #endif
@@ -1739,6 +1743,9 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 #endif // TOOLS_ENABLED
 		} else if (arg == "--profile-gpu") {
 			profile_gpu = true;
+		} else if (arg == "--benchmark-rendering") {
+			benchmark_rendering = true;
+			cmdline_tool = true;
 		} else if (arg == "--disable-crash-handler") {
 			OS::get_singleton()->disable_crash_handler();
 		} else if (arg == "--skip-breakpoints") {
@@ -3668,6 +3675,10 @@ int Main::start() {
 #endif
 	}
 
+	if (benchmark_rendering) {
+		return RenderingBenchmark().run() ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
 	uint64_t minimum_time_msec = GLOBAL_DEF(PropertyInfo(Variant::INT, "application/boot_splash/minimum_display_time", PROPERTY_HINT_RANGE, "0,100,1,or_greater,suffix:ms"), 0);
 	if (Engine::get_singleton()->is_editor_hint()) {
 		minimum_time_msec = 0;
@@ -4394,20 +4405,26 @@ bool Main::iteration() {
 
 		uint64_t navigation_begin = OS::get_singleton()->get_ticks_usec();
 
-		NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		{
+			MemoryTagScope navigation_tag_scope(Memory::TAG_NAVIGATION);
+			NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		}
 
 		navigation_process_ticks = MAX(navigation_process_ticks, OS::get_singleton()->get_ticks_usec() - navigation_begin); // keep the largest one for reference
 		navigation_process_max = MAX(OS::get_singleton()->get_ticks_usec() - navigation_begin, navigation_process_max);
 
 		message_queue->flush();
 
+		{
+			MemoryTagScope physics_tag_scope(Memory::TAG_PHYSICS);
 #ifndef _3D_DISABLED
-		PhysicsServer3D::get_singleton()->end_sync();
-		PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer3D::get_singleton()->end_sync();
+			PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
 #endif // _3D_DISABLED
 
-		PhysicsServer2D::get_singleton()->end_sync();
-		PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+			PhysicsServer2D::get_singleton()->end_sync();
+			PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+		}
 
 		message_queue->flush();
 
@@ -4728,5 +4745,12 @@ void Main::cleanup(bool p_force) {
 	OS::get_singleton()->benchmark_end_measure("Shutdown", "Main::Cleanup");
 	OS::get_singleton()->benchmark_dump();
 
+	const bool memory_report = OS::get_singleton()->is_stdout_verbose();
+
 	OS::get_singleton()->finalize_core();
+
+	if (memory_report) {
+		// Whatever is still allocated at this point was leaked by its subsystem.
+		Memory::print_tag_report();
+	}
 }
@@ -97,6 +97,14 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_GENERAL);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_RESOURCES);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_SCENE);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_SCRIPTING);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_AUDIO);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_NAVIGATION);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -151,6 +159,14 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("pipeline/compilations_surface"),
 		PNAME("pipeline/compilations_draw"),
 		PNAME("pipeline/compilations_specialization"),
+		PNAME("memory/static_general"),
+		PNAME("memory/static_resources"),
+		PNAME("memory/static_scene"),
+		PNAME("memory/static_scripting"),
+		PNAME("memory/static_rendering"),
+		PNAME("memory/static_physics"),
+		PNAME("memory/static_audio"),
+		PNAME("memory/static_navigation"),
 	};
 
 	return names[p_monitor];
@@ -202,6 +218,22 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW);
 		case PIPELINE_COMPILATIONS_SPECIALIZATION:
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION);
+		case MEMORY_STATIC_GENERAL:
+			return Memory::get_tag_mem_usage(Memory::TAG_GENERAL);
+		case MEMORY_STATIC_RESOURCES:
+			return Memory::get_tag_mem_usage(Memory::TAG_RESOURCES);
+		case MEMORY_STATIC_SCENE:
+			return Memory::get_tag_mem_usage(Memory::TAG_SCENE);
+		case MEMORY_STATIC_SCRIPTING:
+			return Memory::get_tag_mem_usage(Memory::TAG_SCRIPTING);
+		case MEMORY_STATIC_RENDERING:
+			return Memory::get_tag_mem_usage(Memory::TAG_RENDERING);
+		case MEMORY_STATIC_PHYSICS:
+			return Memory::get_tag_mem_usage(Memory::TAG_PHYSICS);
+		case MEMORY_STATIC_AUDIO:
+			return Memory::get_tag_mem_usage(Memory::TAG_AUDIO);
+		case MEMORY_STATIC_NAVIGATION:
+			return Memory::get_tag_mem_usage(Memory::TAG_NAVIGATION);
 		case PHYSICS_2D_ACTIVE_OBJECTS:
 			return PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_ACTIVE_OBJECTS);
 		case PHYSICS_2D_COLLISION_PAIRS:
@@ -292,6 +324,19 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
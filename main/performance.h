@@ -106,6 +106,14 @@ public:
 		PIPELINE_COMPILATIONS_SURFACE,
 		PIPELINE_COMPILATIONS_DRAW,
 		PIPELINE_COMPILATIONS_SPECIALIZATION,
+		MEMORY_STATIC_GENERAL,
+		MEMORY_STATIC_RESOURCES,
+		MEMORY_STATIC_SCENE,
+		MEMORY_STATIC_SCRIPTING,
+		MEMORY_STATIC_RENDERING,
+		MEMORY_STATIC_PHYSICS,
+		MEMORY_STATIC_AUDIO,
+		MEMORY_STATIC_NAVIGATION,
 		MONITOR_MAX
 	};
 
@@ -0,0 +1,239 @@
+/**************************************************************************/
+/*  rendering_benchmark.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "rendering_benchmark.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/os/os.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_default.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+void RenderingBenchmark::_setup_viewport() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	viewport = rs->viewport_create();
+	rs->viewport_set_size(viewport, 1280, 720);
+	rs->viewport_set_update_mode(viewport, RS::VIEWPORT_UPDATE_ALWAYS);
+	rs->viewport_set_active(viewport, true);
+}
+
+void RenderingBenchmark::_setup_3d_instances() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	scenario = rs->scenario_create();
+	camera = rs->camera_create();
+	rs->camera_set_perspective(camera, 75.0, 0.05, 500.0);
+	rs->viewport_set_scenario(viewport, scenario);
+	rs->viewport_attach_camera(viewport, camera);
+
+	RID mesh = rs->get_test_cube();
+	const int grid_size = 64;
+	for (int i = 0; i < grid_size; i++) {
+		for (int j = 0; j < grid_size; j++) {
+			RID instance = rs->instance_create2(mesh, scenario);
+			rs->instance_set_transform(instance, Transform3D(Basis(), Vector3((i - grid_size / 2) * 3.0, 0.0, (j - grid_size / 2) * 3.0)));
+			rids.push_back(instance);
+		}
+	}
+
+	RID sun = rs->directional_light_create();
+	rs->light_set_shadow(sun, true);
+	rids.push_back(sun);
+	RID sun_instance = rs->instance_create2(sun, scenario);
+	rs->instance_set_transform(sun_instance, Transform3D(Basis::from_euler(Vector3(-Math_PI * 0.25, Math_PI * 0.25, 0.0)), Vector3()));
+	rids.push_back(sun_instance);
+
+	for (int i = 0; i < 32; i++) {
+		RID light = rs->omni_light_create();
+		rs->light_set_param(light, RS::LIGHT_PARAM_RANGE, 8.0);
+		rids.push_back(light);
+		RID light_instance = rs->instance_create2(light, scenario);
+		rs->instance_set_transform(light_instance, Transform3D(Basis(), Vector3(((i % 8) - 4) * 20.0, 2.0, ((i / 8) - 2) * 20.0)));
+		rids.push_back(light_instance);
+	}
+}
+
+void RenderingBenchmark::_setup_canvas_items() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	canvas = rs->canvas_create();
+	rs->viewport_attach_canvas(viewport, canvas);
+
+	const int item_count = 10000;
+	for (int i = 0; i < item_count; i++) {
+		RID item = rs->canvas_item_create();
+		rs->canvas_item_set_parent(item, canvas);
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 16, 16), Color::from_hsv((i % 360) / 360.0, 0.8, 0.9));
+		rs->canvas_item_set_transform(item, Transform2D(0.0, Vector2((i * 37) % 1280, (i * 53) % 720)));
+		rids.push_back(item);
+		if (i % 10 == 0) {
+			moving_canvas_items.push_back(item);
+		}
+	}
+}
+
+void RenderingBenchmark::_free_scene() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	// Free in reverse order, so instances go away before their bases.
+	for (int64_t i = int64_t(rids.size()) - 1; i >= 0; i--) {
+		rs->free(rids[i]);
+	}
+	rids.clear();
+	moving_canvas_items.clear();
+
+	RID *owned[] = { &viewport, &camera, &scenario, &canvas };
+	for (RID *rid : owned) {
+		if (rid->is_valid()) {
+			rs->free(*rid);
+			*rid = RID();
+		}
+	}
+}
+
+void RenderingBenchmark::_animate(uint32_t p_frame) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	if (camera.is_valid()) {
+		// Orbit so culling results change every frame.
+		real_t angle = p_frame * 0.01;
+		Vector3 position(Math::sin(angle) * 60.0, 25.0, Math::cos(angle) * 60.0);
+		rs->camera_set_transform(camera, Transform3D().looking_at(-position).translated(position));
+	}
+
+	for (uint32_t i = 0; i < moving_canvas_items.size(); i++) {
+		Vector2 offset((i * 37 + p_frame * 3) % 1280, (i * 53 + p_frame * 2) % 720);
+		rs->canvas_item_set_transform(moving_canvas_items[i], Transform2D(p_frame * 0.02, offset));
+	}
+}
+
+void RenderingBenchmark::_cull_without_render_target(RID p_viewport, RID p_camera, RID p_scenario, RID p_canvas) {
+	// Runs on the render thread, with the same calls RendererViewport makes for a drawn viewport.
+	const Size2 size(1280, 720);
+
+	if (p_camera.is_valid()) {
+		Ref<XRInterface> xr_interface;
+		RSG::scene->render_camera(Ref<RenderSceneBuffers>(), p_camera, p_scenario, p_viewport, size, 0, 1.0, RID(), xr_interface);
+	}
+
+	RendererCanvasCull::Canvas *canvas = RSG::canvas->canvas_owner.get_or_null(p_canvas);
+	if (canvas) {
+		uint64_t stage_from = RenderingServerDefault::draw_stage_begin();
+		RSG::canvas->render_canvas(RID(), canvas, Transform2D(), nullptr, nullptr, Rect2(Point2(), size), RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xFFFFFFFF);
+		RenderingServerDefault::draw_stage_end(RenderingServerDefault::DRAW_STAGE_CANVAS_RENDER, stage_from);
+	}
+}
+
+void RenderingBenchmark::_draw(double p_frame_step) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+
+	rs->draw(true, p_frame_step);
+	if (rs->viewport_get_render_target(viewport).is_null()) {
+		rs->call_on_render_thread(callable_mp_static(&RenderingBenchmark::_cull_without_render_target).bind(viewport, camera, scenario, canvas));
+	}
+}
+
+bool RenderingBenchmark::_run_scene(const String &p_name, uint32_t p_expected_stages) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	const double frame_step = 1.0 / 60.0;
+
+	uint32_t frame = 0;
+	for (; frame < WARMUP_FRAMES; frame++) {
+		_animate(frame);
+		_draw(frame_step);
+	}
+	rs->sync();
+
+	RenderingServerDefault::set_draw_stage_timing_enabled(true);
+	uint64_t from = OS::get_singleton()->get_ticks_usec();
+	for (; frame < WARMUP_FRAMES + MEASURED_FRAMES; frame++) {
+		_animate(frame);
+		_draw(frame_step);
+	}
+	rs->sync();
+	uint64_t total_usec = OS::get_singleton()->get_ticks_usec() - from;
+	RenderingServerDefault::set_draw_stage_timing_enabled(false);
+
+	uint64_t frames = RenderingServerDefault::get_draw_stage_frames();
+	ERR_FAIL_COND_V_MSG(frames == 0, false, vformat("Rendering benchmark scene \"%s\" did not draw any frame.", p_name));
+
+	bool ok = true;
+	for (int i = 0; i < RenderingServerDefault::DRAW_STAGE_MAX; i++) {
+		RenderingServerDefault::DrawStage stage = RenderingServerDefault::DrawStage(i);
+		if ((p_expected_stages & (1 << i)) && RenderingServerDefault::get_draw_stage_calls(stage) == 0) {
+			ERR_PRINT(vformat("Rendering benchmark scene \"%s\" never ran the \"%s\" stage.", p_name, RenderingServerDefault::get_draw_stage_name(stage)));
+			ok = false;
+		}
+	}
+
+	double frame_msec = double(total_usec) / double(frames) / 1000.0;
+	results[vformat("[%s] Frame", p_name)] = frame_msec;
+
+	print_line(vformat("\t[%s]", p_name));
+	print_line(vformat("\t\t- Frame: %.3f msec.", frame_msec));
+	for (int i = 0; i < RenderingServerDefault::DRAW_STAGE_MAX; i++) {
+		RenderingServerDefault::DrawStage stage = RenderingServerDefault::DrawStage(i);
+		String stage_name = RenderingServerDefault::get_draw_stage_name(stage);
+		double stage_msec = double(RenderingServerDefault::get_draw_stage_usec(stage)) / double(frames) / 1000.0;
+		results[vformat("[%s] %s", p_name, stage_name)] = stage_msec;
+		print_line(vformat("\t\t- %s: %.3f msec.", stage_name, stage_msec));
+	}
+	return ok;
+}
+
+bool RenderingBenchmark::run() {
+	print_line(vformat("RENDERING BENCHMARK (%s, average CPU time per frame over %d frames):", OS::get_singleton()->get_current_rendering_driver_name(), MEASURED_FRAMES));
+
+	bool ok = true;
+
+	_setup_viewport();
+	_setup_3d_instances();
+	ok = _run_scene("3D Instances", (1 << RenderingServerDefault::DRAW_STAGE_SCENE_CULL) | (1 << RenderingServerDefault::DRAW_STAGE_SCENE_RENDER)) && ok;
+	_free_scene();
+
+	_setup_viewport();
+	_setup_canvas_items();
+	ok = _run_scene("Canvas Items", 1 << RenderingServerDefault::DRAW_STAGE_CANVAS_RENDER) && ok;
+	_free_scene();
+
+	RenderingServer::get_singleton()->sync();
+
+	String benchmark_file = OS::get_singleton()->get_benchmark_file();
+	if (benchmark_file.is_empty()) {
+		return ok;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(benchmark_file, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(f.is_null(), false, vformat("Can't open rendering benchmark file '%s'.", benchmark_file));
+	f->store_string(JSON::stringify(results, "\t", false, true));
+	return ok;
+}
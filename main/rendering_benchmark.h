@@ -0,0 +1,73 @@
+/**************************************************************************/
+/*  rendering_benchmark.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef RENDERING_BENCHMARK_H
+#define RENDERING_BENCHMARK_H
+
+#include "core/templates/local_vector.h"
+#include "core/variant/dictionary.h"
+#include "servers/rendering_server.h"
+
+// Built-in scene suite run by --benchmark-rendering. It measures the CPU time spent in each
+// stage of RenderingServer frame drawing, so it also works with the dummy rasterizer (--headless)
+// or a software Vulkan driver on machines without a GPU. The dummy rasterizer has no render
+// targets, so viewports are never drawn; in that case the benchmark culls the scene itself.
+class RenderingBenchmark {
+	enum {
+		WARMUP_FRAMES = 30,
+		MEASURED_FRAMES = 300,
+	};
+
+	RID viewport;
+	RID camera;
+	RID scenario;
+	RID canvas;
+	LocalVector<RID> rids;
+	LocalVector<RID> moving_canvas_items;
+
+	Dictionary results;
+
+	void _setup_viewport();
+	void _setup_3d_instances();
+	void _setup_canvas_items();
+	void _free_scene();
+	void _animate(uint32_t p_frame);
+	void _draw(double p_frame_step);
+	bool _run_scene(const String &p_name, uint32_t p_expected_stages);
+
+	static void _cull_without_render_target(RID p_viewport, RID p_camera, RID p_scenario, RID p_canvas);
+
+public:
+	// Returns false if a scene did not exercise the stages it is meant to measure,
+	// or if results could not be written.
+	bool run();
+};
+
+#endif // RENDERING_BENCHMARK_H
@@ -634,9 +634,14 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 	real_t total_angular_velocity = angular_velocity + biased_angular_velocity;
 	Vector2 total_linear_velocity = linear_velocity + biased_linear_velocity;
 
-	real_t angle_delta = total_angular_velocity * p_step;
+	// Only advance up to the time of impact found by the CCD sweep, the velocity is kept
+	// so the contact is generated and solved on the next step.
+	real_t motion_step = p_step * ccd_motion_fraction;
+	ccd_motion_fraction = 1.0;
+
+	real_t angle_delta = total_angular_velocity * motion_step;
 	real_t angle = get_transform().get_rotation() + angle_delta;
-	Vector2 pos = get_transform().get_origin() + total_linear_velocity * p_step;
+	Vector2 pos = get_transform().get_origin() + total_linear_velocity * motion_step;
 
 	if (center_of_mass.length_squared() > CMP_EPSILON2) {
 		// Calculate displacement due to center of mass offset.
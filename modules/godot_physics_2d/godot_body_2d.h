@@ -98,6 +98,8 @@ class GodotBody2D : public GodotCollisionObject2D {
 
 	VSet<RID> exceptions;
 	PhysicsServer2D::CCDMode continuous_cd_mode = PhysicsServer2D::CCD_MODE_DISABLED;
+	// Fraction of this step's motion to integrate, set by the CCD sweep when a time of impact was found.
+	real_t ccd_motion_fraction = 1.0;
 	bool omit_force_integration = false;
 	bool active = true;
 	bool can_sleep = true;
@@ -303,6 +305,8 @@ public:
 	_FORCE_INLINE_ void set_continuous_collision_detection_mode(PhysicsServer2D::CCDMode p_mode) { continuous_cd_mode = p_mode; }
 	_FORCE_INLINE_ PhysicsServer2D::CCDMode get_continuous_collision_detection_mode() const { return continuous_cd_mode; }
 
+	_FORCE_INLINE_ void set_ccd_motion_fraction(real_t p_fraction) { ccd_motion_fraction = p_fraction; }
+
 	void set_space(GodotSpace2D *p_space) override;
 
 	void update_mass_properties();
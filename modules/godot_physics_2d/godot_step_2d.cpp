@@ -30,6 +30,8 @@
 
 #include "godot_step_2d.h"
 
+#include "godot_collision_solver_2d.h"
+
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
@@ -38,6 +40,9 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define CCD_BODY_COUNT_RESERVE 256
+#define CCD_SWEEP_QUERY_MAX 64
+#define CCD_SWEEP_ITERATIONS 8
 
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -125,6 +130,93 @@ void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island) cons
 	}
 }
 
+void GodotStep2D::_sweep_ccd_body(uint32_t p_body_index, GodotSpace2D *p_space) {
+	GodotBody2D *body = ccd_bodies[p_body_index];
+	const Vector2 motion = (body->get_linear_velocity() + body->get_biased_linear_velocity()) * delta;
+
+	LocalVector<GodotCollisionObject2D *> results;
+	LocalVector<int> result_shapes;
+	results.resize(CCD_SWEEP_QUERY_MAX);
+	result_shapes.resize(CCD_SWEEP_QUERY_MAX);
+
+	real_t best_fraction = 1.0;
+
+	for (int i = 0; i < body->get_shape_count(); i++) {
+		if (body->is_shape_disabled(i)) {
+			continue;
+		}
+
+		const GodotShape2D *shape = body->get_shape(i);
+		const Transform2D xform = body->get_transform() * body->get_shape_transform(i);
+
+		Rect2 aabb = xform.xform(shape->get_aabb());
+		aabb = aabb.merge(Rect2(aabb.position + motion, aabb.size));
+
+		int amount = p_space->get_broadphase()->cull_aabb(aabb, results.ptr(), results.size(), result_shapes.ptr());
+		while (amount == int(results.size())) {
+			// The query may have been cut short, skipping a candidate could let the body tunnel through it.
+			results.resize(results.size() * 2);
+			result_shapes.resize(result_shapes.size() * 2);
+			amount = p_space->get_broadphase()->cull_aabb(aabb, results.ptr(), results.size(), result_shapes.ptr());
+		}
+
+		for (int j = 0; j < amount; j++) {
+			GodotCollisionObject2D *col_obj = results[j];
+			if (col_obj == body || col_obj->get_type() != GodotCollisionObject2D::TYPE_BODY) {
+				continue;
+			}
+
+			GodotBody2D *other = static_cast<GodotBody2D *>(col_obj);
+			int other_shape_idx = result_shapes[j];
+
+			if (!body->collides_with(other) || body->has_exception(other->get_self()) || other->has_exception(body->get_self())) {
+				continue;
+			}
+
+			// One-way collisions depend on contact history, leave them to the regular pair processing.
+			if (other->is_shape_disabled(other_shape_idx) || other->is_shape_set_as_one_way_collision(other_shape_idx)) {
+				continue;
+			}
+
+			// Sweep in the frame of the other body, so two fast bodies don't miss each other.
+			Vector2 relative_motion = motion;
+			if (other->get_mode() >= PhysicsServer2D::BODY_MODE_KINEMATIC) {
+				relative_motion -= (other->get_linear_velocity() + other->get_biased_linear_velocity()) * delta;
+			}
+
+			const GodotShape2D *other_shape = other->get_shape(other_shape_idx);
+			const Transform2D other_xform = other->get_transform() * other->get_shape_transform(other_shape_idx);
+
+			// Does it collide if going all the way?
+			if (!GodotCollisionSolver2D::solve(shape, xform, relative_motion * best_fraction, other_shape, other_xform, Vector2(), nullptr, nullptr)) {
+				continue;
+			}
+
+			// Already touching, the contact will be handled by the solver.
+			if (GodotCollisionSolver2D::solve(shape, xform, Vector2(), other_shape, other_xform, Vector2(), nullptr, nullptr)) {
+				continue;
+			}
+
+			real_t low = 0.0;
+			real_t hi = best_fraction;
+			for (int k = 0; k < CCD_SWEEP_ITERATIONS; k++) {
+				real_t fraction = (low + hi) * 0.5;
+				Vector2 sep = relative_motion.normalized(); // Speeds up SAT by testing the motion axis first.
+				if (GodotCollisionSolver2D::solve(shape, xform, relative_motion * fraction, other_shape, other_xform, Vector2(), nullptr, nullptr, &sep)) {
+					hi = fraction;
+				} else {
+					low = fraction;
+				}
+			}
+
+			// Stop at the first colliding fraction, so there is a slight overlap to generate contacts from on the next step.
+			best_fraction = hi;
+		}
+	}
+
+	ccd_fractions[p_body_index] = best_fraction;
+}
+
 void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	p_space->lock(); // can't access space during this
 
@@ -269,6 +361,48 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 		profile_begtime = profile_endtime;
 	}
 
+	/* SWEEP FAST BODIES */
+
+	// Conservative advancement for bodies with CCD enabled that move further than a fraction of their size
+	// this step. Each one is swept against the broadphase in parallel using the final solved velocities, and
+	// only advanced up to its earliest time of impact. Unlike the pair based checks in GodotBodyPair2D::setup,
+	// this works with relative motion, so fast bodies can't tunnel through each other either.
+
+	ccd_bodies.clear();
+
+	b = body_list->first();
+	while (b) {
+		GodotBody2D *body = b->self();
+		if (body->get_mode() > PhysicsServer2D::BODY_MODE_KINEMATIC && body->get_continuous_collision_detection_mode() != PhysicsServer2D::CCD_MODE_DISABLED) {
+			// Same heuristic as the pair checks: only sweep if it moves more than 1/3 of its size.
+			real_t min_extent = 0.0;
+			for (int i = 0; i < body->get_shape_count(); i++) {
+				if (!body->is_shape_disabled(i)) {
+					Size2 size = body->get_shape(i)->get_aabb().size;
+					min_extent = min_extent > 0.0 ? MIN(min_extent, MIN(size.x, size.y)) : MIN(size.x, size.y);
+				}
+			}
+			Vector2 motion = (body->get_linear_velocity() + body->get_biased_linear_velocity()) * p_delta;
+			if (min_extent > 0.0 && motion.length_squared() > min_extent * min_extent * 0.09) {
+				ccd_bodies.push_back(body);
+			}
+		}
+		b = b->next();
+	}
+
+	if (!ccd_bodies.is_empty()) {
+		ccd_fractions.resize(ccd_bodies.size());
+
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_sweep_ccd_body, p_space, ccd_bodies.size(), -1, true, SNAME("Physics2DSweepFastBodies"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (uint32_t i = 0; i < ccd_bodies.size(); i++) {
+			if (ccd_fractions[i] < 1.0) {
+				ccd_bodies[i]->set_ccd_motion_fraction(ccd_fractions[i]);
+			}
+		}
+	}
+
 	/* INTEGRATE VELOCITIES */
 
 	b = body_list->first();
@@ -300,6 +434,8 @@ GodotStep2D::GodotStep2D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+	ccd_bodies.reserve(CCD_BODY_COUNT_RESERVE);
+	ccd_fractions.reserve(CCD_BODY_COUNT_RESERVE);
 }
 
 GodotStep2D::~GodotStep2D() {
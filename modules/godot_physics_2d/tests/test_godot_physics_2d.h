@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*  test_godot_physics_2d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GODOT_PHYSICS_2D_H
+#define TEST_GODOT_PHYSICS_2D_H
+
+#include "../godot_physics_server_2d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotPhysics2D {
+
+TEST_CASE("[GodotPhysics2D] Fast bodies don't tunnel through thin walls") {
+	GodotPhysicsServer2D *server = memnew(GodotPhysicsServer2D);
+	server->init();
+	server->set_active(true);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	LocalVector<RID> bodies;
+
+	// Static bodies next to the path of the fast body, so its sweep finds more candidates than a single query holds.
+	RID clutter_shape = server->rectangle_shape_create();
+	server->shape_set_data(clutter_shape, Vector2(0.5, 0.5));
+	for (int i = 0; i < 10; i++) {
+		for (int j = 0; j < 10; j++) {
+			RID clutter = server->body_create();
+			server->body_set_mode(clutter, PhysicsServer2D::BODY_MODE_STATIC);
+			server->body_add_shape(clutter, clutter_shape);
+			server->body_set_state(clutter, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0.0, Vector2(60 + i * 4, 5 + j * 4)));
+			server->body_set_space(clutter, space);
+			bodies.push_back(clutter);
+		}
+	}
+
+	// The wall is the line x + y = 100, crossed in a single step by the fast body.
+	RID wall_shape = server->segment_shape_create();
+	server->shape_set_data(wall_shape, Rect2(Vector2(30, 70), Vector2(70, 30)));
+	RID wall = server->body_create();
+	server->body_set_mode(wall, PhysicsServer2D::BODY_MODE_STATIC);
+	server->body_add_shape(wall, wall_shape);
+	server->body_set_space(wall, space);
+	bodies.push_back(wall);
+
+	RID ball_shape = server->circle_shape_create();
+	server->shape_set_data(ball_shape, 2.0);
+	RID ball = server->body_create();
+	server->body_set_mode(ball, PhysicsServer2D::BODY_MODE_RIGID);
+	server->body_add_shape(ball, ball_shape);
+	server->body_set_param(ball, PhysicsServer2D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+	server->body_set_continuous_collision_detection_mode(ball, PhysicsServer2D::CCD_MODE_CAST_SHAPE);
+	server->body_set_state(ball, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, Vector2(6000, 6000));
+	server->body_set_space(ball, space);
+	bodies.push_back(ball);
+
+	for (int i = 0; i < 4; i++) {
+		server->step(1.0 / 60.0);
+		Transform2D xform = server->body_get_state(ball, PhysicsServer2D::BODY_STATE_TRANSFORM);
+		CHECK_MESSAGE(xform.get_origin().x + xform.get_origin().y < 100, "The fast body should stop at the wall instead of passing through it.");
+	}
+
+	for (const RID &body : bodies) {
+		server->free(body);
+	}
+	server->free(clutter_shape);
+	server->free(wall_shape);
+	server->free(ball_shape);
+	server->free(space);
+	server->finish();
+	memdelete(server);
+}
+
+} // namespace TestGodotPhysics2D
+
+#endif // TEST_GODOT_PHYSICS_2D_H
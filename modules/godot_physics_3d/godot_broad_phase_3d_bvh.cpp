@@ -125,4 +125,8 @@ GodotBroadPhase3D *GodotBroadPhase3DBVH::_create() {
 GodotBroadPhase3DBVH::GodotBroadPhase3DBVH() {
 	bvh.set_pair_callback(_pair_callback, this);
 	bvh.set_unpair_callback(_unpair_callback, this);
+
+	// Static colliders are usually streamed in by the thousands and then never move,
+	// keep them out of the per-frame refit and only pair them once per update.
+	bvh.params_set_lazy_trees(TREE_FLAG_STATIC);
 }
@@ -1703,8 +1703,30 @@ int GodotHeightMapShape3D::get_depth() const {
 }
 
 void GodotHeightMapShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	//not very useful, but not very used either
-	p_transform.xform(get_aabb()).project_range_in_plane(Plane(p_normal), r_min, r_max);
+	if (bounds_levels.is_empty()) {
+		p_transform.xform(get_aabb()).project_range_in_plane(Plane(p_normal), r_min, r_max);
+		return;
+	}
+
+	// Project the nodes of a coarse pyramid level, which is much tighter than the whole AABB for hilly terrain.
+	int level = bounds_levels.size() - 1;
+	while (level > 0 && bounds_levels[level - 1].ranges.size() <= 64) {
+		level--;
+	}
+
+	const BoundsLevel &bounds_level = bounds_levels[level];
+	const Plane plane(p_normal);
+	r_min = 1e20;
+	r_max = -1e20;
+
+	for (int z = 0; z < bounds_level.depth; z++) {
+		for (int x = 0; x < bounds_level.width; x++) {
+			real_t node_min, node_max;
+			p_transform.xform(_get_bounds_node_aabb(level, x, z)).project_range_in_plane(plane, node_min, node_max);
+			r_min = MIN(r_min, node_min);
+			r_max = MAX(r_max, node_max);
+		}
+	}
 }
 
 Vector3 GodotHeightMapShape3D::get_support(const Vector3 &p_normal) const {
@@ -1770,39 +1792,39 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
-	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
+// Parametric range of the segment inside the box, clipped to the segment itself.
+static _FORCE_INLINE_ bool _heightmap_segment_box_range(const Vector3 &p_begin, const Vector3 &p_delta, const AABB &p_box, real_t &r_enter, real_t &r_exit) {
+	real_t enter = 0.0;
+	real_t exit = 1.0;
 
-	Vector3 enter_pos;
-	Vector3 exit_pos;
+	for (int i = 0; i < 3; i++) {
+		real_t box_min = p_box.position[i];
+		real_t box_max = p_box.position[i] + p_box.size[i];
 
-	if (p_state.length_flat > CMP_EPSILON) {
-		real_t flat_to_3d = p_state.length / p_state.length_flat;
-		real_t enter_param = p_state.prev_dist * flat_to_3d;
-		real_t exit_param = p_state.dist * flat_to_3d;
-		enter_pos = p_params.from + p_params.dir * enter_param;
-		exit_pos = p_params.from + p_params.dir * exit_param;
-	} else {
-		// Consider the ray vertical.
-		// (though we shouldn't reach this often because there is an early check up-front)
-		enter_pos = p_params.from;
-		exit_pos = p_params.to;
-	}
+		if (Math::abs(p_delta[i]) < CMP_EPSILON) {
+			if (p_begin[i] < box_min || p_begin[i] > box_max) {
+				return false;
+			}
+			continue;
+		}
 
-	// Transform positions to heightmap space.
-	enter_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-	exit_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
+		real_t inv = 1.0 / p_delta[i];
+		real_t t0 = (box_min - p_begin[i]) * inv;
+		real_t t1 = (box_max - p_begin[i]) * inv;
+		if (t0 > t1) {
+			SWAP(t0, t1);
+		}
 
-	// We did enter the flat projection of the AABB,
-	// but we have to check if we intersect it on the vertical axis.
-	if ((enter_pos.y > chunk.max) && (exit_pos.y > chunk.max)) {
-		return false;
-	}
-	if ((enter_pos.y < chunk.min) && (exit_pos.y < chunk.min)) {
-		return false;
+		enter = MAX(enter, t0);
+		exit = MIN(exit, t1);
+		if (enter > exit) {
+			return false;
+		}
 	}
 
-	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
+	r_enter = enter;
+	r_exit = exit;
+	return true;
 }
 
 template <typename ProcessFunction>
@@ -1982,7 +2004,7 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			r_normal = params.normal;
 			return true;
 		}
-	} else if (bounds_grid.is_empty()) {
+	} else if (bounds_levels.is_empty()) {
 		// Process all cells intersecting the flat projection of the ray.
 		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 	} else {
@@ -1992,15 +2014,64 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			// Don't use chunks, the ray is too short in the plane.
 			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 		} else {
-			// The ray is long, run raycast on a higher-level grid.
-			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_to = p_end / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
-			// Plus 1 here to width and depth of the chunk because _intersect_grid_segment() is used by cell level as well,
-			// and in _intersect_grid_segment() the loop will exit 1 early because for cell point triangle lookup, it dose x + 1, z + 1 etc for the vertex.
-			int bounds_width = bounds_grid_width + 1;
-			int bounds_depth = bounds_grid_depth + 1;
-			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_width, bounds_depth, bounds_offset, r_point, r_normal);
+			// The ray is long, descend the min/max pyramid and only walk the cells of chunks it can hit.
+			return _intersect_segment_node(bounds_levels.size() - 1, 0, 0, p_begin, p_end, r_point, r_normal);
+		}
+	}
+
+	return false;
+}
+
+bool GodotHeightMapShape3D::_intersect_segment_node(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
+	const Vector3 delta = p_end - p_begin;
+
+	if (p_level == 0) {
+		real_t enter, exit;
+		if (!_heightmap_segment_box_range(p_begin, delta, _get_bounds_node_aabb(0, p_x, p_z), enter, exit)) {
+			return false;
+		}
+
+		// Walk the cells of this chunk only, with a small margin so cells on the chunk border aren't skipped.
+		const real_t margin = 0.5 / MAX(Math::abs(delta.x), Math::abs(delta.z));
+		Vector3 chunk_begin = p_begin + delta * MAX(enter - margin, (real_t)0.0);
+		Vector3 chunk_end = p_begin + delta * MIN(exit + margin, (real_t)1.0);
+		return _intersect_grid_segment(_heightmap_cell_cull_segment, chunk_begin, chunk_end, width, depth, local_origin, r_point, r_normal);
+	}
+
+	// Visit the children hit by the segment front to back, so the first hit found is the closest.
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	int child_x[4];
+	int child_z[4];
+	real_t child_enter[4];
+	int child_count = 0;
+
+	for (int i = 0; i < 4; i++) {
+		int x = p_x * 2 + (i & 1);
+		int z = p_z * 2 + (i >> 1);
+		if (x >= child_level.width || z >= child_level.depth) {
+			continue;
+		}
+
+		real_t enter, exit;
+		if (!_heightmap_segment_box_range(p_begin, delta, _get_bounds_node_aabb(p_level - 1, x, z), enter, exit)) {
+			continue;
+		}
+
+		int j = child_count++;
+		while (j > 0 && child_enter[j - 1] > enter) {
+			child_x[j] = child_x[j - 1];
+			child_z[j] = child_z[j - 1];
+			child_enter[j] = child_enter[j - 1];
+			j--;
+		}
+		child_x[j] = x;
+		child_z[j] = z;
+		child_enter[j] = enter;
+	}
+
+	for (int i = 0; i < child_count; i++) {
+		if (_intersect_segment_node(p_level - 1, child_x[i], child_z[i], p_begin, p_end, r_point, r_normal)) {
+			return true;
 		}
 	}
 
@@ -2058,26 +2129,70 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
+	if (bounds_levels.is_empty()) {
+		_cull_cells(start_x, end_x, start_z, end_z, face, p_callback, p_userdata);
+	} else {
+		// Skip whole chunks which are entirely above or below the queried AABB.
+		_cull_node(bounds_levels.size() - 1, 0, 0, p_local_aabb, start_x, end_x, start_z, end_z, face, p_callback, p_userdata);
+	}
+}
+
+bool GodotHeightMapShape3D::_cull_node(int p_level, int p_x, int p_z, const AABB &p_local_aabb, int p_start_x, int p_end_x, int p_start_z, int p_end_z, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const {
+	const Range &range = _get_bounds_node(p_level, p_x, p_z);
+	if (range.max < p_local_aabb.position.y || range.min > p_local_aabb.position.y + p_local_aabb.size.y) {
+		return false;
+	}
+
+	const int node_size = BOUNDS_CHUNK_SIZE << p_level;
+	const int node_start_x = MAX(p_x * node_size, p_start_x);
+	const int node_end_x = MIN((p_x + 1) * node_size, p_end_x);
+	const int node_start_z = MAX(p_z * node_size, p_start_z);
+	const int node_end_z = MIN((p_z + 1) * node_size, p_end_z);
+	if (node_start_x >= node_end_x || node_start_z >= node_end_z) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return _cull_cells(node_start_x, node_end_x, node_start_z, node_end_z, p_face, p_callback, p_userdata);
+	}
+
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	for (int i = 0; i < 4; i++) {
+		int x = p_x * 2 + (i & 1);
+		int z = p_z * 2 + (i >> 1);
+		if (x < child_level.width && z < child_level.depth) {
+			if (_cull_node(p_level - 1, x, z, p_local_aabb, p_start_x, p_end_x, p_start_z, p_end_z, p_face, p_callback, p_userdata)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool GodotHeightMapShape3D::_cull_cells(int p_start_x, int p_end_x, int p_start_z, int p_end_z, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const {
+	for (int z = p_start_z; z < p_end_z; z++) {
+		for (int x = p_start_x; x < p_end_x; x++) {
 			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			_get_point(x, z, p_face.vertex[0]);
+			_get_point(x + 1, z, p_face.vertex[1]);
+			_get_point(x, z + 1, p_face.vertex[2]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
 			}
 
 			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			p_face.vertex[0] = p_face.vertex[1];
+			_get_point(x + 1, z + 1, p_face.vertex[1]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
 			}
 		}
 	}
+
+	return false;
 }
 
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -2091,72 +2206,176 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 }
 
 void GodotHeightMapShape3D::_build_accelerator() {
-	bounds_grid.clear();
+	bounds_levels.clear();
 
-	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
-	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
+	int bounds_width = width / BOUNDS_CHUNK_SIZE;
+	int bounds_depth = depth / BOUNDS_CHUNK_SIZE;
 
 	if (width % BOUNDS_CHUNK_SIZE > 0) {
-		++bounds_grid_width; // In case terrain size isn't dividable by chunk size.
+		++bounds_width; // In case terrain size isn't dividable by chunk size.
 	}
 
 	if (depth % BOUNDS_CHUNK_SIZE > 0) {
-		++bounds_grid_depth;
+		++bounds_depth;
 	}
 
-	uint32_t bound_grid_size = (uint32_t)(bounds_grid_width * bounds_grid_depth);
-
-	if (bound_grid_size < 2) {
+	if (bounds_width * bounds_depth < 2) {
 		// Grid is empty or just one chunk.
 		return;
 	}
 
-	bounds_grid.resize(bound_grid_size);
-
-	// Compute min and max height for all chunks.
-	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
-		int z0 = cz * BOUNDS_CHUNK_SIZE;
-
-		for (int cx = 0; cx < bounds_grid_width; ++cx) {
-			int x0 = cx * BOUNDS_CHUNK_SIZE;
-
-			Range r;
-
-			r.min = _get_height(x0, z0);
-			r.max = r.min;
-
-			// Compute min and max height for this chunk.
-			// We have to include one extra cell to account for neighbors.
-			// Here is why:
-			// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
-			//
-			//   Left        Right
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			//           x
-			//
-			// If the AABB for the Left chunk did not share vertices with the Right,
-			// then we would fail collision tests at x due to a gap.
-			//
-			int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
-			int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
-			for (int z = z0; z < z_max; ++z) {
-				for (int x = x0; x < x_max; ++x) {
-					real_t height = _get_height(x, z);
-					if (height < r.min) {
-						r.min = height;
-					} else if (height > r.max) {
-						r.max = height;
+	// Level 0 holds the min and max height of each chunk, every level above merges 2x2 nodes
+	// of the level below, up to a single root node.
+	while (true) {
+		BoundsLevel level;
+		level.width = bounds_width;
+		level.depth = bounds_depth;
+		level.ranges.resize(bounds_width * bounds_depth);
+		bounds_levels.push_back(level);
+
+		if (bounds_width == 1 && bounds_depth == 1) {
+			break;
+		}
+
+		bounds_width = (bounds_width + 1) / 2;
+		bounds_depth = (bounds_depth + 1) / 2;
+	}
+
+	_update_accelerator(0, 0, width - 1, depth - 1);
+}
+
+GodotHeightMapShape3D::Range GodotHeightMapShape3D::_compute_chunk_range(int p_chunk_x, int p_chunk_z) const {
+	int x0 = p_chunk_x * BOUNDS_CHUNK_SIZE;
+	int z0 = p_chunk_z * BOUNDS_CHUNK_SIZE;
+
+	Range r;
+
+	r.min = _get_height(x0, z0);
+	r.max = r.min;
+
+	// Compute min and max height for this chunk.
+	// We have to include one extra cell to account for neighbors.
+	// Here is why:
+	// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
+	//
+	//   Left        Right
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	// |   |   |   |   |   |
+	// 0---0---0---1---1---1
+	//           x
+	//
+	// If the AABB for the Left chunk did not share vertices with the Right,
+	// then we would fail collision tests at x due to a gap.
+	//
+	int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
+	int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
+	for (int z = z0; z < z_max; ++z) {
+		for (int x = x0; x < x_max; ++x) {
+			real_t height = _get_height(x, z);
+			if (height < r.min) {
+				r.min = height;
+			} else if (height > r.max) {
+				r.max = height;
+			}
+		}
+	}
+
+	return r;
+}
+
+void GodotHeightMapShape3D::_update_accelerator(int p_from_x, int p_from_z, int p_to_x, int p_to_z) {
+	if (bounds_levels.is_empty()) {
+		return;
+	}
+
+	// Vertices on a chunk border also belong to the previous chunk.
+	int from_x = MAX(p_from_x - 1, 0) / BOUNDS_CHUNK_SIZE;
+	int from_z = MAX(p_from_z - 1, 0) / BOUNDS_CHUNK_SIZE;
+	int to_x = MIN(p_to_x / BOUNDS_CHUNK_SIZE, bounds_levels[0].width - 1);
+	int to_z = MIN(p_to_z / BOUNDS_CHUNK_SIZE, bounds_levels[0].depth - 1);
+
+	BoundsLevel &chunks = bounds_levels[0];
+	for (int cz = from_z; cz <= to_z; ++cz) {
+		for (int cx = from_x; cx <= to_x; ++cx) {
+			chunks.ranges[cx + cz * chunks.width] = _compute_chunk_range(cx, cz);
+		}
+	}
+
+	for (uint32_t l = 1; l < bounds_levels.size(); l++) {
+		from_x /= 2;
+		from_z /= 2;
+		to_x /= 2;
+		to_z /= 2;
+
+		const BoundsLevel &child_level = bounds_levels[l - 1];
+		BoundsLevel &level = bounds_levels[l];
+
+		for (int z = from_z; z <= to_z; ++z) {
+			for (int x = from_x; x <= to_x; ++x) {
+				Range r = child_level.ranges[(x * 2) + (z * 2) * child_level.width];
+				for (int i = 1; i < 4; i++) {
+					int child_x = x * 2 + (i & 1);
+					int child_z = z * 2 + (i >> 1);
+					if (child_x < child_level.width && child_z < child_level.depth) {
+						const Range &child = child_level.ranges[child_x + child_z * child_level.width];
+						r.min = MIN(r.min, child.min);
+						r.max = MAX(r.max, child.max);
 					}
 				}
+				level.ranges[x + z * level.width] = r;
 			}
+		}
+	}
+}
+
+AABB GodotHeightMapShape3D::_get_bounds_node_aabb(int p_level, int p_x, int p_z) const {
+	const Range &range = _get_bounds_node(p_level, p_x, p_z);
+	const int node_size = BOUNDS_CHUNK_SIZE << p_level;
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+	int x0 = MIN(p_x * node_size, width - 1);
+	int z0 = MIN(p_z * node_size, depth - 1);
+	int x1 = MIN(x0 + node_size, width - 1);
+	int z1 = MIN(z0 + node_size, depth - 1);
+
+	AABB aabb;
+	aabb.position = Vector3(x0, range.min, z0) - local_origin;
+	aabb.size = Vector3(x1 - x0, range.max - range.min, z1 - z0);
+	return aabb;
+}
+
+void GodotHeightMapShape3D::_update_region(const Rect2i &p_region, const Vector<real_t> &p_heights) {
+	ERR_FAIL_COND(p_region.position.x < 0 || p_region.position.y < 0);
+	ERR_FAIL_COND(p_region.size.x <= 0 || p_region.size.y <= 0);
+	ERR_FAIL_COND(p_region.position.x + p_region.size.x > width || p_region.position.y + p_region.size.y > depth);
+	ERR_FAIL_COND(p_heights.size() != p_region.size.x * p_region.size.y);
+
+	const real_t *r = p_heights.ptr();
+	real_t *w = heights.ptrw();
+	real_t region_min = r[0];
+	real_t region_max = r[0];
+
+	for (int z = 0; z < p_region.size.y; ++z) {
+		for (int x = 0; x < p_region.size.x; ++x) {
+			real_t height = r[x + z * p_region.size.x];
+			w[(p_region.position.x + x) + (p_region.position.y + z) * width] = height;
+			region_min = MIN(region_min, height);
+			region_max = MAX(region_max, height);
 		}
 	}
+
+	_update_accelerator(p_region.position.x, p_region.position.y, p_region.position.x + p_region.size.x - 1, p_region.position.y + p_region.size.y - 1);
+
+	// Only grow the AABB, so lowering the terrain doesn't require a full scan.
+	AABB aabb_new = get_aabb();
+	real_t aabb_min = MIN(aabb_new.position.y, region_min);
+	real_t aabb_max = MAX(aabb_new.position.y + aabb_new.size.y, region_max);
+	aabb_new.position.y = aabb_min;
+	aabb_new.size.y = aabb_max - aabb_min;
+
+	// Always notify the owners, even if the AABB is unchanged, so bodies resting on the region are woken up.
+	configure(aabb_new);
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
@@ -2226,6 +2445,13 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 #endif
 	}
 
+	if (d.has("region")) {
+		// Partial update of the existing heights, e.g. for deformable terrain.
+		ERR_FAIL_COND(width_new != width || depth_new != depth);
+		_update_region(d["region"], heights_buffer);
+		return;
+	}
+
 	// Compute min and max heights or use precomputed values.
 	real_t min_height = 0.0;
 	real_t max_height = 0.0;
@@ -0,0 +1,292 @@
+/**************************************************************************/
+/*  test_godot_physics_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GODOT_PHYSICS_3D_H
+#define TEST_GODOT_PHYSICS_3D_H
+
+#include "../godot_physics_server_3d.h"
+#include "servers/physics_server_3d_wrap_mt.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotPhysics3D {
+
+static Dictionary make_heightmap_data(int p_width, int p_depth, const Vector<real_t> &p_heights, const Rect2i &p_region = Rect2i()) {
+	Dictionary d;
+	d["width"] = p_width;
+	d["depth"] = p_depth;
+	d["heights"] = p_heights;
+	if (p_region.has_area()) {
+		d["region"] = p_region;
+	} else {
+		real_t min_height = 0.0;
+		real_t max_height = 0.0;
+		for (const real_t &height : p_heights) {
+			min_height = MIN(min_height, height);
+			max_height = MAX(max_height, height);
+		}
+		d["min_height"] = min_height;
+		d["max_height"] = max_height;
+	}
+	return d;
+}
+
+TEST_CASE("[GodotPhysics3D] Heightmap queries") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+	server->set_active(true);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	// Vertex (x, z) of the map is at (x - 16, height, z - 16), with a spike that rises far above the rest.
+	const int size = 33;
+	const int spike_x = 20;
+	const int spike_z = 10;
+	Vector<real_t> heights;
+	heights.resize(size * size);
+	for (int z = 0; z < size; z++) {
+		for (int x = 0; x < size; x++) {
+			heights.write[z * size + x] = 2.0 * Math::sin(x * 0.3) * Math::cos(z * 0.2);
+		}
+	}
+	heights.write[spike_z * size + spike_x] = 8.0;
+
+	RID shape = server->heightmap_shape_create();
+	server->shape_set_data(shape, make_heightmap_data(size, size, heights));
+	RID terrain = server->body_create();
+	server->body_set_mode(terrain, PhysicsServer3D::BODY_MODE_STATIC);
+	server->body_add_shape(terrain, shape);
+	server->body_set_space(terrain, space);
+
+	PhysicsDirectSpaceState3D *state = server->space_get_direct_state(space);
+
+	// Height of the first triangle of a cell, at a quarter of the cell from its first vertex.
+	auto expected_height = [&](int p_x, int p_z) {
+		return 0.5 * heights[p_z * size + p_x] + 0.25 * heights[p_z * size + p_x + 1] + 0.25 * heights[(p_z + 1) * size + p_x];
+	};
+	auto cast_down = [&](int p_x, int p_z, PhysicsDirectSpaceState3D::RayResult &r_result) {
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		parameters.from = Vector3(p_x + 0.25 - 16, 20, p_z + 0.25 - 16);
+		parameters.to = Vector3(p_x + 0.25 - 16, -20, p_z + 0.25 - 16);
+		return state->intersect_ray(parameters, r_result);
+	};
+	// Crosses the map next to the spike, above the rest of the terrain.
+	PhysicsDirectSpaceState3D::RayParameters across;
+	across.from = Vector3(-20, 5, spike_z + 0.1 - 16);
+	across.to = Vector3(20, 5, spike_z + 0.1 - 16);
+
+	PhysicsDirectSpaceState3D::RayResult result;
+	for (int z = 0; z < size - 1; z += 3) {
+		for (int x = 0; x < size - 1; x += 3) {
+			REQUIRE(cast_down(x, z, result));
+			CHECK(result.position.y == doctest::Approx(expected_height(x, z)).epsilon(0.001));
+		}
+	}
+	for (int z = spike_z - 1; z <= spike_z; z++) {
+		for (int x = spike_x - 1; x <= spike_x; x++) {
+			REQUIRE(cast_down(x, z, result));
+			CHECK_MESSAGE(result.position.y == doctest::Approx(expected_height(x, z)).epsilon(0.001), "Cells around the spike should be found at their full height.");
+		}
+	}
+	REQUIRE(state->intersect_ray(across, result));
+	CHECK(result.position.x >= spike_x - 1 - 16);
+	CHECK(result.position.x <= spike_x + 1 - 16);
+
+	// Flatten the area around the spike, the rest of the map must be unchanged.
+	const Rect2i region = Rect2i(spike_x - 2, spike_z - 2, 5, 5);
+	Vector<real_t> region_heights;
+	region_heights.resize(region.size.x * region.size.y);
+	region_heights.fill(0.0);
+	server->shape_set_data(shape, make_heightmap_data(size, size, region_heights, region));
+	for (int z = region.position.y; z < region.get_end().y; z++) {
+		for (int x = region.position.x; x < region.get_end().x; x++) {
+			heights.write[z * size + x] = 0.0;
+		}
+	}
+
+	for (int z = spike_z - 4; z <= spike_z + 3; z++) {
+		for (int x = spike_x - 4; x <= spike_x + 3; x++) {
+			REQUIRE(cast_down(x, z, result));
+			CHECK(result.position.y == doctest::Approx(expected_height(x, z)).epsilon(0.001));
+		}
+	}
+	CHECK_FALSE_MESSAGE(state->intersect_ray(across, result), "The spike was removed by the region update.");
+
+	server->free(terrain);
+	server->free(shape);
+	server->free(space);
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics3D] Heightmap region updates wake resting bodies") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+	server->set_active(true);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	// A flat map with one low corner, so lowering its center doesn't grow its bounds.
+	const int size = 17;
+	Vector<real_t> heights;
+	heights.resize(size * size);
+	heights.fill(0.0);
+	heights.write[0] = -2.0;
+
+	RID terrain_shape = server->heightmap_shape_create();
+	server->shape_set_data(terrain_shape, make_heightmap_data(size, size, heights));
+	RID terrain = server->body_create();
+	server->body_set_mode(terrain, PhysicsServer3D::BODY_MODE_STATIC);
+	server->body_add_shape(terrain, terrain_shape);
+	server->body_set_space(terrain, space);
+
+	RID box_shape = server->box_shape_create();
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	RID box = server->body_create();
+	server->body_set_mode(box, PhysicsServer3D::BODY_MODE_RIGID);
+	server->body_add_shape(box, box_shape);
+	server->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 0.55, 0)));
+	server->body_set_space(box, space);
+
+	for (int i = 0; i < 240; i++) {
+		server->step(1.0 / 60.0);
+	}
+	REQUIRE(bool(server->body_get_state(box, PhysicsServer3D::BODY_STATE_SLEEPING)));
+
+	const Rect2i region = Rect2i(6, 6, 5, 5);
+	Vector<real_t> region_heights;
+	region_heights.resize(region.size.x * region.size.y);
+	region_heights.fill(-1.0);
+	server->shape_set_data(terrain_shape, make_heightmap_data(size, size, region_heights, region));
+	server->step(1.0 / 60.0);
+	CHECK_FALSE_MESSAGE(bool(server->body_get_state(box, PhysicsServer3D::BODY_STATE_SLEEPING)), "Changing the terrain under a sleeping body should wake it up.");
+
+	for (int i = 0; i < 60; i++) {
+		server->step(1.0 / 60.0);
+	}
+	Transform3D xform = server->body_get_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK_MESSAGE(xform.origin.y < 0.0, "The body should fall onto the lowered terrain.");
+
+	server->free(box);
+	server->free(terrain);
+	server->free(box_shape);
+	server->free(terrain_shape);
+	server->free(space);
+	server->finish();
+	memdelete(server);
+}
+
+#ifdef THREADS_ENABLED
+TEST_CASE("[GodotPhysics3D] Body state is buffered when running on a separate thread") {
+	GodotPhysicsServer3D *inner = memnew(GodotPhysicsServer3D(true));
+	PhysicsServer3D *server = memnew(PhysicsServer3DWrapMT(inner, true));
+	server->init();
+	server->set_active(true);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	RID shape = server->sphere_shape_create();
+	server->shape_set_data(shape, 0.5);
+	RID body = server->body_create();
+	server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+	server->body_add_shape(body, shape);
+	server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 10, 0)));
+	server->body_set_space(body, space);
+
+	// Same order as the main loop, the step runs on the server thread until the next sync.
+	auto step_and_sync = [&]() {
+		server->step(1.0 / 60.0);
+		server->sync();
+		server->end_sync();
+	};
+	auto get_origin = [&](RID p_body) {
+		return Transform3D(server->body_get_state(p_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin;
+	};
+	// Only safe while the server thread is idle, i.e. right after a sync.
+	auto get_inner_origin = [&](RID p_body) {
+		return Transform3D(inner->body_get_state(p_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin;
+	};
+
+	CHECK_MESSAGE(get_origin(body) == Vector3(0, 10, 0), "Bodies that were never stepped should be read through the command queue.");
+
+	for (int i = 0; i < 10; i++) {
+		step_and_sync();
+	}
+	CHECK(get_origin(body).y < 10.0);
+	CHECK(get_origin(body) == get_inner_origin(body));
+	CHECK(Vector3(server->body_get_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY)).y < 0.0);
+	CHECK_FALSE(bool(server->body_get_state(body, PhysicsServer3D::BODY_STATE_SLEEPING)));
+
+	// Written while a step is running, must be read back both before and after the step is published.
+	server->step(1.0 / 60.0);
+	server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 50, 0)));
+	CHECK(get_origin(body) == Vector3(0, 50, 0));
+	server->sync();
+	server->end_sync();
+	CHECK_MESSAGE(get_origin(body) == Vector3(0, 50, 0), "Writes issued after the step was queued should survive the buffer swap.");
+
+	step_and_sync();
+	CHECK(get_origin(body).y < 50.0);
+	CHECK(get_origin(body).y > 49.0);
+	CHECK(get_origin(body) == get_inner_origin(body));
+
+	// Bodies created or freed between steps take or give up their slot on the next sync.
+	RID other = server->body_create();
+	server->body_set_mode(other, PhysicsServer3D::BODY_MODE_RIGID);
+	server->body_add_shape(other, shape);
+	server->body_set_state(other, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(5, 20, 0)));
+	server->body_set_space(other, space);
+	CHECK(get_origin(other) == Vector3(5, 20, 0));
+
+	step_and_sync();
+	CHECK(get_origin(other) == get_inner_origin(other));
+	step_and_sync();
+	CHECK(get_origin(other) == get_inner_origin(other));
+	CHECK(get_origin(other).y < 20.0);
+
+	server->free(body);
+	step_and_sync();
+	CHECK_MESSAGE(get_origin(other) == get_inner_origin(other), "The slot of the remaining body should keep its own state after another body is freed.");
+	CHECK(get_origin(other).y > 15.0);
+
+	server->free(other);
+	server->free(shape);
+	server->free(space);
+	server->finish();
+	memdelete(server);
+}
+#endif // THREADS_ENABLED
+
+} // namespace TestGodotPhysics3D
+
+#endif // TEST_GODOT_PHYSICS_3D_H
@@ -47,6 +47,7 @@ void JoltProjectSettings::register_settings() {
 	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "physics/jolt_physics_3d/simulation/use_enhanced_internal_edge_removal"), true);
 	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "physics/jolt_physics_3d/simulation/areas_detect_static_bodies"), false);
 	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "physics/jolt_physics_3d/simulation/generate_all_kinematic_contacts"), false);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::BOOL, "physics/jolt_physics_3d/simulation/high_priority_jobs"), true);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/jolt_physics_3d/simulation/penetration_slop", PROPERTY_HINT_RANGE, U"0,1,0.00001,or_greater,suffix:m"), 0.02f);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/jolt_physics_3d/simulation/speculative_contact_distance", PROPERTY_HINT_RANGE, U"0,1,0.00001,or_greater,suffix:m"), 0.02f);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/jolt_physics_3d/simulation/baumgarte_stabilization_factor", PROPERTY_HINT_RANGE, U"0,1,0.01"), 0.2f);
@@ -102,6 +103,10 @@ bool JoltProjectSettings::should_generate_all_kinematic_contacts() {
 	return GLOBAL_GET("physics/jolt_physics_3d/simulation/generate_all_kinematic_contacts");
 }
 
+bool JoltProjectSettings::use_high_priority_jobs() {
+	return GLOBAL_GET("physics/jolt_physics_3d/simulation/high_priority_jobs");
+}
+
 float JoltProjectSettings::get_penetration_slop() {
 	return GLOBAL_GET("physics/jolt_physics_3d/simulation/penetration_slop");
 }
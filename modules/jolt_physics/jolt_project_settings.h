@@ -42,6 +42,7 @@ public:
 	static bool use_enhanced_internal_edge_removal_for_bodies();
 	static bool areas_detect_static_bodies();
 	static bool should_generate_all_kinematic_contacts();
+	static bool use_high_priority_jobs();
 	static float get_penetration_slop();
 	static float get_speculative_contact_distance();
 	static float get_baumgarte_stabilization_factor();
@@ -49,12 +49,9 @@ void JoltJobSystem::Job::_execute(void *p_user_data) {
 	job->Execute();
 
 #ifdef DEBUG_ENABLED
-	const uint64_t time_end = Time::get_singleton()->get_ticks_usec();
-	const uint64_t time_elapsed = time_end - time_start;
-
-	timings_lock.lock();
-	timings_by_job[job->name] += time_elapsed;
-	timings_lock.unlock();
+	// Jolt may have already executed this job on a thread waiting for a barrier, in which case this
+	// only measures the no-op, but that's fine since the time was spent on that thread's job instead.
+	job->time_elapsed += Time::get_singleton()->get_ticks_usec() - time_start;
 #endif
 
 	job->Release();
@@ -97,14 +94,14 @@ JoltJobSystem::Job *JoltJobSystem::Job::pop_completed() {
 	return prev_head;
 }
 
-void JoltJobSystem::Job::queue() {
+void JoltJobSystem::Job::queue(bool p_high_priority) {
 	AddRef();
 
 	// Ideally we would use Jolt's actual job name here, but I'd rather not incur the overhead of a memory allocation or
 	// thread-safe lookup every time we create/queue a task. So instead we use the same cached description for all of them.
 	static const String task_name("Jolt Physics");
 
-	task_id = WorkerThreadPool::get_singleton()->add_native_task(&_execute, this, true, task_name);
+	task_id = WorkerThreadPool::get_singleton()->add_native_task(&_execute, this, p_high_priority, task_name);
 }
 
 int JoltJobSystem::GetMaxConcurrency() const {
@@ -140,7 +137,7 @@ JPH::JobHandle JoltJobSystem::CreateJob(const char *p_name, JPH::ColorArg p_colo
 }
 
 void JoltJobSystem::QueueJob(JPH::JobSystem::Job *p_job) {
-	static_cast<Job *>(p_job)->queue();
+	static_cast<Job *>(p_job)->queue(high_priority);
 }
 
 void JoltJobSystem::QueueJobs(JPH::JobSystem::Job **p_jobs, JPH::uint p_job_count) {
@@ -154,14 +151,30 @@ void JoltJobSystem::FreeJob(JPH::JobSystem::Job *p_job) {
 }
 
 void JoltJobSystem::_reclaim_jobs() {
+#ifdef DEBUG_ENABLED
+	timings_lock.lock();
+#endif
+
 	while (Job *job = Job::pop_completed()) {
+#ifdef DEBUG_ENABLED
+		timings_by_job[job->get_name()] += job->get_time_elapsed();
+#endif
+
 		jobs.DestructObject(job);
 	}
+
+#ifdef DEBUG_ENABLED
+	timings_lock.unlock();
+#endif
 }
 
 JoltJobSystem::JoltJobSystem() :
 		JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers),
-		thread_count(MAX(1, WorkerThreadPool::get_singleton()->get_thread_count())) {
+		high_priority(JoltProjectSettings::use_high_priority_jobs()) {
+	// Low-priority tasks only get a share of the worker threads, so don't let Jolt split its work any finer than that.
+	WorkerThreadPool *worker_thread_pool = WorkerThreadPool::get_singleton();
+	thread_count = MAX(1, high_priority ? worker_thread_pool->get_thread_count() : worker_thread_pool->get_low_priority_thread_count());
+
 	jobs.Init(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsJobs);
 }
 
@@ -180,6 +193,8 @@ void JoltJobSystem::flush_timings() {
 
 	EngineDebugger *engine_debugger = EngineDebugger::get_singleton();
 
+	timings_lock.lock();
+
 	if (engine_debugger->is_profiling(profiler_name)) {
 		Array timings;
 
@@ -196,6 +211,8 @@ void JoltJobSystem::flush_timings() {
 	for (KeyValue<const void *, uint64_t> &E : timings_by_job) {
 		E.value = 0;
 	}
+
+	timings_lock.unlock();
 }
 
 #endif
@@ -48,6 +48,7 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 
 #ifdef DEBUG_ENABLED
 		const char *name = nullptr;
+		uint64_t time_elapsed = 0;
 #endif
 
 		int64_t task_id = -1;
@@ -65,7 +66,12 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 		static void push_completed(Job *p_job);
 		static Job *pop_completed();
 
-		void queue();
+#ifdef DEBUG_ENABLED
+		const char *get_name() const { return name; }
+		uint64_t get_time_elapsed() const { return time_elapsed; }
+#endif
+
+		void queue(bool p_high_priority);
 
 		Job &operator=(const Job &p_other) = delete;
 		Job &operator=(Job &&p_other) = delete;
@@ -76,13 +82,15 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 	// are always literals and as such will point to the same address every time.
 	inline static HashMap<const void *, uint64_t> timings_by_job;
 
-	// TODO: Check whether the usage of SpinLock is justified or if this should be a mutex instead.
+	// Timings are gathered when jobs are reclaimed rather than when they finish executing,
+	// which is almost always on the physics thread, so this is rarely contended.
 	inline static SpinLock timings_lock;
 #endif
 
 	JPH::FixedSizeFreeList<Job> jobs;
 
 	int thread_count = 0;
+	bool high_priority = true;
 
 	virtual int GetMaxConcurrency() const override;
 
@@ -0,0 +1,549 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "raster_occlusion_cull.h"
+
+#include "core/object/worker_thread_pool.h"
+
+void RasterOcclusionCull::RasterHZBuffer::clear() {
+	HZBuffer::clear();
+
+	tile_bins.clear();
+	tile_grid_size = Size2i();
+}
+
+void RasterOcclusionCull::RasterHZBuffer::resize(const Size2i &p_size) {
+	if (p_size == Size2i()) {
+		clear();
+		return;
+	}
+
+	if (!sizes.is_empty() && p_size == sizes[0]) {
+		return; // Size didn't change
+	}
+
+	HZBuffer::resize(p_size);
+
+	tile_grid_size = Size2i(Math::ceil(p_size.x / (float)TILE_WIDTH), Math::ceil(p_size.y / (float)TILE_HEIGHT));
+	tile_bins.resize(tile_grid_size.x * tile_grid_size.y);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(const LocalVector<ScreenTriangle> &p_triangles, const Vector2 &p_ray_scale, float p_z_far, bool p_cam_orthogonal) {
+	// Bin triangles into the tiles they overlap, so each tile only walks its own triangles.
+	for (LocalVector<uint32_t> &bin : tile_bins) {
+		bin.clear();
+	}
+
+	for (uint32_t i = 0; i < p_triangles.size(); i++) {
+		const Rect2i &rect = p_triangles[i].rect;
+		int from_x = rect.position.x / TILE_WIDTH;
+		int from_y = rect.position.y / TILE_HEIGHT;
+		int to_x = (rect.position.x + rect.size.x - 1) / TILE_WIDTH;
+		int to_y = (rect.position.y + rect.size.y - 1) / TILE_HEIGHT;
+
+		for (int y = from_y; y <= to_y; y++) {
+			for (int x = from_x; x <= to_x; x++) {
+				tile_bins[y * tile_grid_size.x + x].push_back(i);
+			}
+		}
+	}
+
+	RasterThreadData td;
+	td.triangles = &p_triangles;
+	td.ray_scale = p_ray_scale;
+	td.clear_depth = p_z_far * 1.05f;
+	td.camera_orthogonal = p_cam_orthogonal;
+
+	debug_tex_range = td.clear_depth;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_rasterize_tile, &td, tile_bins.size(), -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_rasterize_tile(uint32_t p_tile, const RasterThreadData *p_data) {
+	const Size2i &buffer_size = sizes[0];
+	const int tile_x = (p_tile % tile_grid_size.x) * TILE_WIDTH;
+	const int tile_y = (p_tile / tile_grid_size.x) * TILE_HEIGHT;
+	const int tile_end_x = MIN(tile_x + TILE_WIDTH, buffer_size.x);
+	const int tile_end_y = MIN(tile_y + TILE_HEIGHT, buffer_size.y);
+	float *depth = mips[0];
+
+	for (int y = tile_y; y < tile_end_y; y++) {
+		for (int x = tile_x; x < tile_end_x; x++) {
+			depth[y * buffer_size.x + x] = p_data->clear_depth;
+		}
+	}
+
+	const LocalVector<ScreenTriangle> &triangles = *p_data->triangles;
+
+	for (uint32_t triangle_index : tile_bins[p_tile]) {
+		const ScreenTriangle &triangle = triangles[triangle_index];
+
+		Vector2 p0 = triangle.points[0];
+		Vector2 p1 = triangle.points[1];
+		Vector2 p2 = triangle.points[2];
+		float d0 = triangle.depths[0];
+		float d1 = triangle.depths[1];
+		float d2 = triangle.depths[2];
+
+		float area = (p1 - p0).cross(p2 - p0);
+		if (Math::abs(area) < CMP_EPSILON) {
+			continue;
+		}
+
+		// Occluders are double-sided, make the winding consistent.
+		if (area < 0.0f) {
+			SWAP(p1, p2);
+			SWAP(d1, d2);
+			area = -area;
+		}
+
+		const float inv_area = 1.0f / area;
+		const int from_x = MAX(triangle.rect.position.x, tile_x);
+		const int from_y = MAX(triangle.rect.position.y, tile_y);
+		const int to_x = MIN(triangle.rect.position.x + triangle.rect.size.x, tile_end_x);
+		const int to_y = MIN(triangle.rect.position.y + triangle.rect.size.y, tile_end_y);
+
+		// Edge functions at the first pixel center, stepped incrementally along the row.
+		const Vector2 start = Vector2(from_x + 0.5f, from_y + 0.5f);
+		float row_w0 = (p2 - p1).cross(start - p1);
+		float row_w1 = (p0 - p2).cross(start - p2);
+		float row_w2 = (p1 - p0).cross(start - p0);
+		const float step_x0 = p1.y - p2.y;
+		const float step_x1 = p2.y - p0.y;
+		const float step_x2 = p0.y - p1.y;
+		const float step_y0 = p2.x - p1.x;
+		const float step_y1 = p0.x - p2.x;
+		const float step_y2 = p1.x - p0.x;
+
+		for (int y = from_y; y < to_y; y++) {
+			float *row = &depth[y * buffer_size.x];
+			float w0 = row_w0;
+			float w1 = row_w1;
+			float w2 = row_w2;
+
+			// Branchless so the compiler can vectorize the row.
+			for (int x = from_x; x < to_x; x++) {
+				bool inside = w0 >= 0.0f && w1 >= 0.0f && w2 >= 0.0f;
+				float value = (w0 * d0 + w1 * d1 + w2 * d2) * inv_area;
+				float pixel_depth = p_data->camera_orthogonal ? value : 1.0f / value;
+				row[x] = (inside && pixel_depth < row[x]) ? pixel_depth : row[x];
+
+				w0 += step_x0;
+				w1 += step_x1;
+				w2 += step_x2;
+			}
+
+			row_w0 += step_y0;
+			row_w1 += step_y1;
+			row_w2 += step_y2;
+		}
+	}
+
+	if (p_data->camera_orthogonal) {
+		return;
+	}
+
+	// The HZBuffer stores distances from the camera, like the rays of the raycast occlusion culler.
+	for (int y = tile_y; y < tile_end_y; y++) {
+		float ray_y = ((y + 0.5f) / buffer_size.y * 2.0f - 1.0f) * p_data->ray_scale.y;
+		for (int x = tile_x; x < tile_end_x; x++) {
+			float ray_x = ((x + 0.5f) / buffer_size.x * 2.0f - 1.0f) * p_data->ray_scale.x;
+			float &pixel = depth[y * buffer_size.x + x];
+			pixel = MIN(pixel * Math::sqrt(1.0f + ray_x * ray_x + ray_y * ray_y), p_data->clear_depth);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+
+	for (const InstanceID &E : occluder->users) {
+		RID scenario_rid = E.scenario;
+		RID instance_rid = E.instance;
+		ERR_CONTINUE(!scenarios.has(scenario_rid));
+		Scenario &scenario = scenarios[scenario_rid];
+		ERR_CONTINUE(!scenario.instances.has(instance_rid));
+
+		if (!scenario.dirty_instances.has(instance_rid)) {
+			scenario.dirty_instances.insert(instance_rid);
+			scenario.dirty_instances_array.push_back(instance_rid);
+		}
+	}
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+	scenarios[p_scenario].occluder_owner = &occluder_owner;
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	Scenario &scenario = scenarios[p_scenario];
+
+	if (!scenario.instances.has(p_instance)) {
+		scenario.instances[p_instance] = OccluderInstance();
+		scenario.dirty = true;
+	}
+
+	OccluderInstance &instance = scenario.instances[p_instance];
+
+	bool changed = false;
+
+	if (instance.removed) {
+		instance.removed = false;
+		scenario.removed_instances.erase(p_instance);
+		changed = true; // It was removed and re-added, we might have missed some changes
+	}
+
+	if (instance.occluder != p_occluder) {
+		Occluder *old_occluder = occluder_owner.get_or_null(instance.occluder);
+		if (old_occluder) {
+			old_occluder->users.erase(InstanceID(p_scenario, p_instance));
+		}
+
+		instance.occluder = p_occluder;
+
+		if (p_occluder.is_valid()) {
+			Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+			ERR_FAIL_NULL(occluder);
+			occluder->users.insert(InstanceID(p_scenario, p_instance));
+		}
+		changed = true;
+	}
+
+	if (instance.xform != p_xform) {
+		instance.xform = p_xform;
+		changed = true;
+	}
+
+	if (instance.enabled != p_enabled) {
+		instance.enabled = p_enabled;
+		scenario.dirty = true; // The active list needs a rebuild, but the instance doesn't need update
+	}
+
+	if (changed && !scenario.dirty_instances.has(p_instance)) {
+		scenario.dirty_instances.insert(p_instance);
+		scenario.dirty_instances_array.push_back(p_instance);
+		scenario.dirty = true;
+	}
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	Scenario &scenario = scenarios[p_scenario];
+
+	if (scenario.instances.has(p_instance)) {
+		OccluderInstance &instance = scenario.instances[p_instance];
+
+		if (!instance.removed) {
+			Occluder *occluder = occluder_owner.get_or_null(instance.occluder);
+			if (occluder) {
+				occluder->users.erase(InstanceID(p_scenario, p_instance));
+			}
+
+			scenario.removed_instances.push_back(p_instance);
+			instance.removed = true;
+		}
+	}
+}
+
+void RasterOcclusionCull::Scenario::_update_dirty_instance(uint32_t p_idx, RID *p_instances) {
+	OccluderInstance *occ_inst = instances.getptr(p_instances[p_idx]);
+
+	if (!occ_inst) {
+		return;
+	}
+
+	Occluder *occ = occluder_owner->get_or_null(occ_inst->occluder);
+
+	if (!occ) {
+		occ_inst->xformed_vertices.clear();
+		occ_inst->indices.clear();
+		return;
+	}
+
+	int vertices_size = occ->vertices.size();
+	const Vector3 *read_ptr = occ->vertices.ptr();
+
+	occ_inst->xformed_vertices.resize(vertices_size);
+	occ_inst->aabb = AABB();
+
+	for (int i = 0; i < vertices_size; i++) {
+		Vector3 vertex = occ_inst->xform.xform(read_ptr[i]);
+		occ_inst->xformed_vertices[i] = vertex;
+		if (i == 0) {
+			occ_inst->aabb.position = vertex;
+		} else {
+			occ_inst->aabb.expand_to(vertex);
+		}
+	}
+
+	// Drop out of range indices here, so projection doesn't have to check them every frame.
+	int indices_size = occ->indices.size() - occ->indices.size() % 3;
+	const int32_t *indices_ptr = occ->indices.ptr();
+
+	occ_inst->indices.clear();
+	for (int i = 0; i < indices_size; i += 3) {
+		if ((uint32_t)indices_ptr[i] < (uint32_t)vertices_size && (uint32_t)indices_ptr[i + 1] < (uint32_t)vertices_size && (uint32_t)indices_ptr[i + 2] < (uint32_t)vertices_size) {
+			occ_inst->indices.push_back(indices_ptr[i]);
+			occ_inst->indices.push_back(indices_ptr[i + 1]);
+			occ_inst->indices.push_back(indices_ptr[i + 2]);
+		}
+	}
+}
+
+void RasterOcclusionCull::Scenario::update() {
+	if (!dirty && removed_instances.is_empty() && dirty_instances_array.is_empty()) {
+		return;
+	}
+
+	for (const RID &instance : removed_instances) {
+		instances.erase(instance);
+	}
+
+	if (dirty_instances_array.size() / WorkerThreadPool::get_singleton()->get_thread_count() > 128) {
+		// Lots of instances, use per-instance threading
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Scenario::_update_dirty_instance, dirty_instances_array.ptr(), dirty_instances_array.size(), -1, true, SNAME("RasterOcclusionCullUpdate"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	} else {
+		for (uint32_t i = 0; i < dirty_instances_array.size(); i++) {
+			_update_dirty_instance(i, dirty_instances_array.ptr());
+		}
+	}
+
+	dirty_instances.clear();
+	dirty_instances_array.clear();
+	removed_instances.clear();
+
+	active_instances.clear();
+	for (KeyValue<RID, OccluderInstance> &E : instances) {
+		if (E.value.enabled && !E.value.indices.is_empty()) {
+			active_instances.push_back(&E.value);
+		}
+	}
+
+	dirty = false;
+}
+
+void RasterOcclusionCull::Scenario::_project_instance(uint32_t p_idx, const ProjectionThreadData *p_data) {
+	OccluderInstance *occ_inst = active_instances[p_idx];
+	occ_inst->screen_triangles.clear();
+
+	// Skip occluders entirely outside of the view frustum.
+	for (const Plane &plane : p_data->frustum_planes) {
+		if (plane.distance_to(occ_inst->aabb.get_support(-plane.normal)) > 0.0) {
+			return;
+		}
+	}
+
+	const Vector3 *vertices = occ_inst->xformed_vertices.ptr();
+	const uint32_t *indices = occ_inst->indices.ptr();
+	const uint32_t indices_size = occ_inst->indices.size();
+	const Vector2 buffer_size = p_data->buffer_size;
+
+	for (uint32_t i = 0; i < indices_size; i += 3) {
+		Vector3 triangle[3] = {
+			p_data->cam_inv_transform.xform(vertices[indices[i]]),
+			p_data->cam_inv_transform.xform(vertices[indices[i + 1]]),
+			p_data->cam_inv_transform.xform(vertices[indices[i + 2]]),
+		};
+
+		// Clip against the near plane, which turns the triangle into up to a quad.
+		Vector3 clipped[4];
+		int clipped_count = 0;
+		for (int j = 0; j < 3; j++) {
+			const Vector3 &a = triangle[j];
+			const Vector3 &b = triangle[(j + 1) % 3];
+			real_t da = -a.z - p_data->z_near;
+			real_t db = -b.z - p_data->z_near;
+
+			if (da >= 0.0) {
+				clipped[clipped_count++] = a;
+			}
+			if ((da >= 0.0) != (db >= 0.0)) {
+				clipped[clipped_count++] = a.lerp(b, da / (da - db));
+			}
+		}
+
+		if (clipped_count < 3) {
+			continue;
+		}
+
+		Vector2 points[4];
+		float depths[4];
+		Vector2 rect_min = Vector2(FLT_MAX, FLT_MAX);
+		Vector2 rect_max = Vector2(-FLT_MAX, -FLT_MAX);
+
+		for (int j = 0; j < clipped_count; j++) {
+			Plane projected = p_data->cam_projection.xform4(Plane(clipped[j], 1.0));
+			real_t w = p_data->camera_orthogonal ? 1.0 : projected.d;
+			points[j] = Vector2(projected.normal.x / w * 0.5f + 0.5f, projected.normal.y / w * 0.5f + 0.5f) * buffer_size;
+			depths[j] = p_data->camera_orthogonal ? -clipped[j].z : 1.0f / -clipped[j].z;
+			rect_min = rect_min.min(points[j]);
+			rect_max = rect_max.max(points[j]);
+		}
+
+		Rect2i rect;
+		rect.position = Point2i(MAX(0, (int)Math::floor(rect_min.x)), MAX(0, (int)Math::floor(rect_min.y)));
+		Point2i rect_end = Point2i(MIN(p_data->buffer_size.x, (int)Math::ceil(rect_max.x)), MIN(p_data->buffer_size.y, (int)Math::ceil(rect_max.y)));
+		if (rect_end.x <= rect.position.x || rect_end.y <= rect.position.y) {
+			continue; // Off screen.
+		}
+		rect.size = rect_end - rect.position;
+
+		for (int j = 1; j < clipped_count - 1; j++) {
+			ScreenTriangle screen_triangle;
+			screen_triangle.points[0] = points[0];
+			screen_triangle.points[1] = points[j];
+			screen_triangle.points[2] = points[j + 1];
+			screen_triangle.depths[0] = depths[0];
+			screen_triangle.depths[1] = depths[j];
+			screen_triangle.depths[2] = depths[j + 1];
+			screen_triangle.rect = rect;
+			occ_inst->screen_triangles.push_back(screen_triangle);
+		}
+	}
+}
+
+void RasterOcclusionCull::Scenario::project(const Transform3D &p_cam_transform, const Projection &p_cam_projection, const Size2i &p_buffer_size, bool p_cam_orthogonal) {
+	screen_triangles.clear();
+
+	if (active_instances.is_empty()) {
+		return;
+	}
+
+	ProjectionThreadData td;
+	td.cam_inv_transform = p_cam_transform.affine_inverse();
+	td.cam_projection = p_cam_projection;
+	td.frustum_planes = p_cam_projection.get_projection_planes(p_cam_transform);
+	td.buffer_size = p_buffer_size;
+	td.z_near = p_cam_projection.get_z_near();
+	td.camera_orthogonal = p_cam_orthogonal;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Scenario::_project_instance, &td, active_instances.size(), -1, true, SNAME("RasterOcclusionCullProject"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (const OccluderInstance *occ_inst : active_instances) {
+		for (const ScreenTriangle &screen_triangle : occ_inst->screen_triangles) {
+			screen_triangles.push_back(screen_triangle);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	if (!buffers.has(p_buffer)) {
+		return;
+	}
+
+	RasterHZBuffer &buffer = buffers[p_buffer];
+
+	if (buffer.is_empty() || !scenarios.has(buffer.scenario_rid)) {
+		return;
+	}
+
+	Scenario &scenario = scenarios[buffer.scenario_rid];
+	scenario.update();
+	scenario.project(p_cam_transform, p_cam_projection, buffer.get_occlusion_buffer_size(), p_cam_orthogonal);
+
+	Vector2 ray_scale = p_cam_projection.get_viewport_half_extents() / p_cam_projection.get_z_near();
+	buffer.rasterize(scenario.screen_triangles, ray_scale, p_cam_projection.get_z_far(), p_cam_orthogonal);
+	buffer.update_mips();
+}
+
+RasterOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	if (!buffers.has(p_buffer)) {
+		return nullptr;
+	}
+	return &buffers[p_buffer];
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
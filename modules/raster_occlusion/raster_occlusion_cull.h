@@ -0,0 +1,168 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef RASTER_OCCLUSION_CULL_H
+#define RASTER_OCCLUSION_CULL_H
+
+#include "core/math/projection.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid_owner.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
+
+// Software depth rasterizer used for occlusion culling when Embree isn't available.
+// Occluder triangles are projected and binned into screen tiles, then each tile is
+// rasterized on its own thread into the depth buffer that the HZBuffer mips are built from.
+class RasterOcclusionCull : public RendererSceneOcclusionCull {
+public:
+	static const int TILE_WIDTH = 64;
+	static const int TILE_HEIGHT = 16;
+
+	struct ScreenTriangle {
+		Vector2 points[3];
+		// Perspective: inverse view depth, orthogonal: view depth. Linear in screen space either way.
+		float depths[3];
+		Rect2i rect;
+	};
+
+	class RasterHZBuffer : public HZBuffer {
+	private:
+		struct RasterThreadData {
+			const LocalVector<ScreenTriangle> *triangles = nullptr;
+			Vector2 ray_scale;
+			float clear_depth = 0.0f;
+			bool camera_orthogonal = false;
+		};
+
+		Size2i tile_grid_size;
+		LocalVector<LocalVector<uint32_t>> tile_bins;
+
+		void _rasterize_tile(uint32_t p_tile, const RasterThreadData *p_data);
+
+	public:
+		RID scenario_rid;
+
+		virtual void clear() override;
+		virtual void resize(const Size2i &p_size) override;
+		void rasterize(const LocalVector<ScreenTriangle> &p_triangles, const Vector2 &p_ray_scale, float p_z_far, bool p_cam_orthogonal);
+	};
+
+private:
+	struct InstanceID {
+		RID scenario;
+		RID instance;
+
+		static uint32_t hash(const InstanceID &p_ins) {
+			uint32_t h = hash_murmur3_one_64(p_ins.scenario.get_id());
+			return hash_fmix32(hash_murmur3_one_64(p_ins.instance.get_id(), h));
+		}
+		bool operator==(const InstanceID &rhs) const {
+			return instance == rhs.instance && rhs.scenario == scenario;
+		}
+
+		InstanceID() {}
+		InstanceID(RID s, RID i) :
+				scenario(s), instance(i) {}
+	};
+
+	struct Occluder {
+		PackedVector3Array vertices;
+		PackedInt32Array indices;
+		HashSet<InstanceID, InstanceID> users;
+	};
+
+	struct OccluderInstance {
+		RID occluder;
+		LocalVector<Vector3> xformed_vertices;
+		LocalVector<uint32_t> indices;
+		AABB aabb;
+		Transform3D xform;
+		bool enabled = true;
+		bool removed = false;
+
+		// Written by the projection pass, one array per instance so instances can be projected in parallel.
+		LocalVector<ScreenTriangle> screen_triangles;
+	};
+
+	struct ProjectionThreadData {
+		Transform3D cam_inv_transform;
+		Projection cam_projection;
+		Vector<Plane> frustum_planes;
+		Size2i buffer_size;
+		float z_near = 0.0f;
+		bool camera_orthogonal = false;
+	};
+
+	struct Scenario {
+		RID_PtrOwner<Occluder> *occluder_owner = nullptr;
+		HashMap<RID, OccluderInstance> instances;
+		HashSet<RID> dirty_instances; // To avoid duplicates
+		LocalVector<RID> dirty_instances_array; // To iterate and split into threads
+		LocalVector<RID> removed_instances;
+
+		LocalVector<OccluderInstance *> active_instances;
+		LocalVector<ScreenTriangle> screen_triangles;
+		bool dirty = false;
+
+		void _update_dirty_instance(uint32_t p_idx, RID *p_instances);
+		void _project_instance(uint32_t p_idx, const ProjectionThreadData *p_data);
+		void update();
+		void project(const Transform3D &p_cam_transform, const Projection &p_cam_projection, const Size2i &p_buffer_size, bool p_cam_orthogonal);
+	};
+
+	RID_PtrOwner<Occluder> occluder_owner;
+	HashMap<RID, Scenario> scenarios;
+	HashMap<RID, RasterHZBuffer> buffers;
+
+public:
+	virtual bool is_occluder(RID p_rid) override;
+	virtual RID occluder_allocate() override;
+	virtual void occluder_initialize(RID p_occluder) override;
+	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) override;
+	virtual void free_occluder(RID p_occluder) override;
+
+	virtual void add_scenario(RID p_scenario) override;
+	virtual void remove_scenario(RID p_scenario) override;
+	virtual void scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) override;
+	virtual void scenario_remove_instance(RID p_scenario, RID p_instance) override;
+
+	virtual void add_buffer(RID p_buffer) override;
+	virtual void remove_buffer(RID p_buffer) override;
+	virtual HZBuffer *buffer_get_ptr(RID p_buffer) override;
+	virtual void buffer_set_scenario(RID p_buffer, RID p_scenario) override;
+	virtual void buffer_set_size(RID p_buffer, const Vector2i &p_size) override;
+	virtual void buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
+
+	virtual RID buffer_get_debug_texture(RID p_buffer) override;
+
+};
+
+#endif // RASTER_OCCLUSION_CULL_H
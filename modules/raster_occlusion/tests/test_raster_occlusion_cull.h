@@ -0,0 +1,159 @@
+/**************************************************************************/
+/*  test_raster_occlusion_cull.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RASTER_OCCLUSION_CULL_H
+#define TEST_RASTER_OCCLUSION_CULL_H
+
+#include "../raster_occlusion_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRasterOcclusionCull {
+
+class TestHZBuffer : public RasterOcclusionCull::RasterHZBuffer {
+public:
+	float get_depth(int p_x, int p_y) const { return mips[0][p_y * sizes[0].x + p_x]; }
+};
+
+// Creating a culler makes it the occlusion culling singleton, give it back to the previous one afterwards.
+class TestOcclusionCull : public RasterOcclusionCull {
+public:
+	static void restore_singleton(RendererSceneOcclusionCull *p_singleton) { singleton = p_singleton; }
+};
+
+static RasterOcclusionCull::ScreenTriangle make_triangle(const Vector2 &p_a, const Vector2 &p_b, const Vector2 &p_c, float p_depth) {
+	RasterOcclusionCull::ScreenTriangle triangle;
+	triangle.points[0] = p_a;
+	triangle.points[1] = p_b;
+	triangle.points[2] = p_c;
+	triangle.depths[0] = p_depth;
+	triangle.depths[1] = p_depth;
+	triangle.depths[2] = p_depth;
+	Rect2 rect = Rect2(p_a, Size2()).expand(p_b).expand(p_c);
+	triangle.rect = Rect2i(rect.position.floor(), (rect.get_end().ceil() - rect.position.floor()));
+	return triangle;
+}
+
+TEST_CASE("[RasterOcclusionCull] Rasterizer") {
+	TestHZBuffer buffer;
+	buffer.resize(Size2i(160, 40)); // Not a multiple of the tile size, so the last tiles are partial.
+	const float z_far = 100.0;
+	const float clear_depth = z_far * 1.05;
+
+	// Orthogonal depths are stored as they are. Two triangles make a quad over several tiles.
+	LocalVector<RasterOcclusionCull::ScreenTriangle> triangles;
+	triangles.push_back(make_triangle(Vector2(20, 4), Vector2(140, 4), Vector2(140, 36), 10.0));
+	triangles.push_back(make_triangle(Vector2(20, 4), Vector2(20, 36), Vector2(140, 36), 10.0));
+	// Wound the other way, nearer and overlapping the quad.
+	triangles.push_back(make_triangle(Vector2(60, 10), Vector2(60, 30), Vector2(100, 10), 5.0));
+
+	buffer.rasterize(triangles, Vector2(1, 1), z_far, true);
+
+	CHECK(buffer.get_depth(0, 0) == doctest::Approx(clear_depth));
+	CHECK(buffer.get_depth(159, 39) == doctest::Approx(clear_depth));
+	CHECK(buffer.get_depth(30, 6) == doctest::Approx(10.0));
+	CHECK(buffer.get_depth(130, 34) == doctest::Approx(10.0));
+	CHECK(buffer.get_depth(65, 15) == doctest::Approx(5.0));
+	CHECK_MESSAGE(buffer.get_depth(95, 25) == doctest::Approx(10.0), "Pixels outside of the nearer triangle keep the depth of the quad.");
+
+	// Rasterizing again clears the previous frame.
+	triangles.clear();
+	buffer.rasterize(triangles, Vector2(1, 1), z_far, true);
+	CHECK(buffer.get_depth(65, 15) == doctest::Approx(clear_depth));
+}
+
+TEST_CASE("[RasterOcclusionCull] Occludees") {
+	RendererSceneOcclusionCull *previous_singleton = RendererSceneOcclusionCull::get_singleton();
+	const bool previous_jitter = RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled;
+	RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled = false;
+
+	TestOcclusionCull *cull = memnew(TestOcclusionCull);
+	const RID scenario = RID::from_uint64(1);
+	const RID buffer = RID::from_uint64(2);
+	const RID instance = RID::from_uint64(3);
+	cull->add_scenario(scenario);
+	cull->add_buffer(buffer);
+	cull->buffer_set_scenario(buffer, scenario);
+	cull->buffer_set_size(buffer, Vector2i(128, 64));
+
+	RID occluder = cull->occluder_allocate();
+	cull->occluder_initialize(occluder);
+	PackedInt32Array indices = { 0, 1, 2, 0, 2, 3 };
+
+	// The camera sits at the origin and looks down -Z.
+	Projection projection;
+	projection.set_perspective(90.0, 2.0, 0.1, 100.0);
+	const Transform3D cam_transform;
+	const Transform3D cam_inv_transform = cam_transform.affine_inverse();
+
+	auto is_occluded = [&](const AABB &p_aabb) {
+		const real_t bounds[6] = { p_aabb.position.x, p_aabb.position.y, p_aabb.position.z, p_aabb.get_end().x, p_aabb.get_end().y, p_aabb.get_end().z };
+		uint64_t timeout = 0;
+		return cull->buffer_get_ptr(buffer)->is_occluded(bounds, cam_transform.origin, cam_inv_transform, projection, projection.get_z_near(), timeout);
+	};
+
+	SUBCASE("Wall facing the camera") {
+		cull->occluder_set_mesh(occluder, { Vector3(-5, -5, -10), Vector3(5, -5, -10), Vector3(5, 5, -10), Vector3(-5, 5, -10) }, indices);
+		cull->scenario_set_instance(scenario, instance, occluder, Transform3D(), true);
+		cull->buffer_update(buffer, cam_transform, projection, false);
+
+		CHECK_MESSAGE(is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "A box behind the wall should be hidden.");
+		CHECK_MESSAGE(!is_occluded(AABB(Vector3(5, -1, -21), Vector3(10, 2, 2))), "A box sticking out from behind the wall should be visible.");
+		CHECK_MESSAGE(!is_occluded(AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2))), "A box in front of the wall should be visible.");
+		CHECK_MESSAGE(!is_occluded(AABB(Vector3(-1, -1, -30), Vector3(2, 2, 29.95))), "A box crossing the near plane should be visible.");
+
+		cull->scenario_set_instance(scenario, instance, occluder, Transform3D(), false);
+		cull->buffer_update(buffer, cam_transform, projection, false);
+		CHECK_MESSAGE(!is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "A disabled occluder should hide nothing.");
+	}
+
+	SUBCASE("Wall crossing the near plane") {
+		// Tilted so its bottom edge is behind the camera, it is 10 units in front of the camera at y = 0.
+		cull->occluder_set_mesh(occluder, { Vector3(-50, -50, 5), Vector3(50, -50, 5), Vector3(50, 50, -25), Vector3(-50, 50, -25) }, indices);
+		cull->scenario_set_instance(scenario, instance, occluder, Transform3D(), true);
+		cull->buffer_update(buffer, cam_transform, projection, false);
+
+		CHECK_MESSAGE(is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "The part of the occluder in front of the near plane should still hide what is behind it.");
+		CHECK_MESSAGE(!is_occluded(AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2))), "A box in front of the wall should be visible.");
+	}
+
+	cull->scenario_remove_instance(scenario, instance);
+	cull->remove_buffer(buffer);
+	cull->remove_scenario(scenario);
+	cull->free_occluder(occluder);
+	memdelete(cull);
+
+	TestOcclusionCull::restore_singleton(previous_singleton);
+	RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled = previous_jitter;
+}
+
+} // namespace TestRasterOcclusionCull
+
+#endif // TEST_RASTER_OCCLUSION_CULL_H
@@ -46,6 +46,10 @@
 #include <stdint.h>
 
 int Node::orphan_node_count = 0;
+SafeNumeric<uint64_t> Node::tree_structure_version;
+
+// Resolved paths kept per node, the cache is cleared when it grows past this.
+static const uint32_t MAX_RESOLVED_PATHS = 32;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
 
@@ -1484,6 +1488,7 @@ StringName Node::get_name() const {
 
 void Node::_set_name_nocheck(const StringName &p_name) {
 	data.name = p_name;
+	_tree_structure_changed();
 }
 
 void Node::set_name(const String &p_name) {
@@ -1503,6 +1508,7 @@ void Node::set_name(const String &p_name) {
 		bool success = data.parent->data.children.replace_key(old_name, data.name);
 		ERR_FAIL_COND_MSG(!success, "Renaming child in hashtable failed, this is a bug.");
 	}
+	_tree_structure_changed();
 
 	if (data.unique_name_in_owner && data.owner) {
 		_acquire_unique_name_in_owner();
@@ -1704,6 +1710,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	_tree_structure_changed();
 
 	p_child->data.internal_mode = p_internal_mode;
 	switch (p_internal_mode) {
@@ -1804,6 +1811,7 @@ void Node::remove_child(Node *p_child) {
 
 	data.children_cache_dirty = true;
 	bool success = data.children.erase(p_child->data.name);
+	_tree_structure_changed();
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
 
 	p_child->data.parent = nullptr;
@@ -1908,16 +1916,62 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// A single relative name takes one lookup anyway. Off the main thread several threads may resolve from the same node, so don't touch the cache.
+	if ((p_path.get_name_count() == 1 && !p_path.is_absolute()) || !Thread::is_main_thread()) {
+		return _resolve_node_path(p_path);
+	}
+
+	if (data.resolved_paths) {
+		const ResolvedPath *resolved = data.resolved_paths->getptr(p_path);
+		if (resolved) {
+			const Node *top = this;
+			for (uint32_t i = 0; i < resolved->up_levels && top; i++) {
+				top = top->data.parent;
+			}
+			if (top && top->data.subtree_version == resolved->version) {
+				return resolved->node;
+			}
+		}
+	} else {
+		data.resolved_paths = memnew((HashMap<NodePath, ResolvedPath>));
+	}
+
+	int up_levels = 0;
+	Node *node = _resolve_node_path(p_path, &up_levels);
+	if (up_levels < 0) {
+		return node; // Went through a node outside its owner's subtree, can't tell what to watch.
+	}
+
+	const Node *top = this;
+	for (int i = 0; i < up_levels; i++) {
+		top = top->data.parent;
+	}
+	if (data.resolved_paths->size() >= MAX_RESOLVED_PATHS && !data.resolved_paths->has(p_path)) {
+		data.resolved_paths->clear();
+	}
+	data.resolved_paths->insert(p_path, { node, uint32_t(up_levels), top->data.subtree_version });
+	return node;
+}
+
+// Also returns how many levels above this node the resolution went in r_up_levels, or -1 if unknown.
+Node *Node::_resolve_node_path(const NodePath &p_path, int *r_up_levels) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
+	// Level of the current node relative to this one, negative above it.
+	int level = 0;
+	int min_level = 0;
+	bool levels_known = true;
+
 	if (!p_path.is_absolute()) {
 		current = const_cast<Node *>(this); //start from this
 	} else {
 		root = const_cast<Node *>(this);
 		while (root->data.parent) {
 			root = root->data.parent; //start from root
+			level--;
 		}
+		min_level = level;
 	}
 
 	for (int i = 0; i < p_path.get_name_count(); i++) {
@@ -1929,39 +1983,79 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 		} else if (name == SNAME("..")) {
 			if (current == nullptr || !current->data.parent) {
-				return nullptr;
+				// The path could resolve once this node gets a parent, and no version changes on this side when that happens.
+				levels_known = false;
+				current = nullptr;
+				break;
 			}
 
 			next = current->data.parent;
+			level--;
+			min_level = MIN(min_level, level);
 		} else if (current == nullptr) {
 			if (name == root->get_name()) {
 				next = root;
 			}
 
 		} else if (name.is_node_unique_name()) {
+			Node *unique_owner = current;
+			int owner_level = level;
 			Node **unique = current->data.owned_unique_nodes.getptr(name);
 			if (!unique && current->data.owner) {
-				unique = current->data.owner->data.owned_unique_nodes.getptr(name);
+				unique_owner = current->data.owner;
+				int distance = current->_get_distance_to_ancestor(unique_owner);
+				levels_known = levels_known && distance >= 0;
+				owner_level = level - distance;
+				min_level = MIN(min_level, owner_level);
+				unique = unique_owner->data.owned_unique_nodes.getptr(name);
 			}
 			if (!unique) {
-				return nullptr;
+				current = nullptr;
+				break;
 			}
 			next = *unique;
+			int distance = next->_get_distance_to_ancestor(unique_owner);
+			levels_known = levels_known && distance >= 0;
+			level = owner_level + distance;
 		} else {
 			next = nullptr;
 			const Node *const *node = current->data.children.getptr(name);
 			if (node) {
 				next = const_cast<Node *>(*node);
 			} else {
-				return nullptr;
+				current = nullptr;
+				break;
 			}
+			level++;
 		}
 		current = next;
 	}
 
+	if (r_up_levels) {
+		*r_up_levels = levels_known ? -min_level : -1;
+	}
 	return current;
 }
 
+int Node::_get_distance_to_ancestor(const Node *p_ancestor) const {
+	int distance = 0;
+	for (const Node *node = this; node; node = node->data.parent) {
+		if (node == p_ancestor) {
+			return distance;
+		}
+		distance++;
+	}
+	return -1;
+}
+
+void Node::_tree_structure_changed() {
+	// Resolved paths only check the version of one ancestor, so it has to change for changes anywhere below it.
+	const uint64_t version = tree_structure_version.increment();
+	for (Node *node = this; node; node = node->data.parent) {
+		node->data.subtree_version = version;
+	}
+}
+
 Node *Node::get_node(const NodePath &p_path) const {
 	Node *node = get_node_or_null(p_path);
 
@@ -2218,6 +2312,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	data.owner = p_owner;
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
+	_tree_structure_changed();
 
 	owner_changed_notify();
 }
@@ -2230,6 +2325,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	data.owner->_tree_structure_changed();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2244,6 +2340,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	data.owner->_tree_structure_changed();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2314,6 +2411,7 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+	_tree_structure_changed();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -4043,6 +4141,10 @@ Node::~Node() {
 	data.children.clear();
 	data.children_cache.clear();
 
+	if (data.resolved_paths) {
+		memdelete(data.resolved_paths);
+	}
+
 	ERR_FAIL_COND(data.parent);
 	ERR_FAIL_COND(data.children_cache.size());
 
@@ -162,6 +162,16 @@ private:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.post_process_priority == p_a->data.post_process_priority ? p_b->is_greater_than(p_a) : p_b->data.post_process_priority > p_a->data.post_process_priority; }
 	};
 
+	// Result of get_node() for a path. It only depends on the subtree of the ancestor up_levels above the node, and is valid while that ancestor's subtree_version matches.
+	struct ResolvedPath {
+		Node *node = nullptr;
+		uint32_t up_levels = 0;
+		uint64_t version = 0;
+	};
+
+	// Source of unique subtree versions.
+	static SafeNumeric<uint64_t> tree_structure_version;
+
 	// This Data struct is to avoid namespace pollution in derived classes.
 	struct Data {
 		String scene_file_path;
@@ -268,6 +278,8 @@ private:
 		mutable bool is_translation_domain_dirty = true;
 
 		mutable NodePath *path_cache = nullptr;
+		mutable HashMap<NodePath, ResolvedPath> *resolved_paths = nullptr;
+		uint64_t subtree_version = 0; // Changes when names, children or owners change in this node or below it.
 
 	} data;
 
@@ -277,6 +289,9 @@ private:
 	String _get_tree_string(const Node *p_node);
 
 	Node *_get_child_by_name(const StringName &p_name) const;
+	Node *_resolve_node_path(const NodePath &p_path, int *r_up_levels = nullptr) const;
+	int _get_distance_to_ancestor(const Node *p_ancestor) const;
+	void _tree_structure_changed();
 
 	void _replace_connections_target(Node *p_new_target);
 
@@ -529,6 +529,7 @@ void SceneTree::iteration_prepare() {
 }
 
 bool SceneTree::physics_process(double p_time) {
+	MemoryTagScope tag_scope(Memory::TAG_SCENE);
 	current_frame++;
 
 	flush_transform_notifications();
@@ -568,6 +569,7 @@ void SceneTree::iteration_end() {
 }
 
 bool SceneTree::process(double p_time) {
+	MemoryTagScope tag_scope(Memory::TAG_SCENE);
 	if (MainLoop::process(p_time)) {
 		_quit = true;
 	}
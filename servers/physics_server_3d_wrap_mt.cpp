@@ -31,6 +31,7 @@
 #include "physics_server_3d_wrap_mt.h"
 
 #include "core/os/os.h"
+#include "core/templates/hash_set.h"
 
 void PhysicsServer3DWrapMT::_assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id) {
 	server_thread = Thread::get_caller_id();
@@ -41,6 +42,11 @@ void PhysicsServer3DWrapMT::_thread_exit() {
 	exit = true;
 }
 
+void PhysicsServer3DWrapMT::_thread_step(real_t p_delta) {
+	physics_server_3d->step(p_delta);
+	_body_states_publish();
+}
+
 void PhysicsServer3DWrapMT::_thread_loop() {
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
@@ -48,11 +54,185 @@ void PhysicsServer3DWrapMT::_thread_loop() {
 	}
 }
 
+/* BODY STATE BUFFERING */
+
+void PhysicsServer3DWrapMT::_body_state_write(BodyStateSnapshot &r_snapshot, BodyState p_state, const Variant &p_value) {
+	switch (p_state) {
+		case BODY_STATE_TRANSFORM: {
+			r_snapshot.transform = p_value;
+		} break;
+		case BODY_STATE_LINEAR_VELOCITY: {
+			r_snapshot.linear_velocity = p_value;
+		} break;
+		case BODY_STATE_ANGULAR_VELOCITY: {
+			r_snapshot.angular_velocity = p_value;
+		} break;
+		case BODY_STATE_SLEEPING: {
+			r_snapshot.sleeping = p_value;
+		} break;
+		case BODY_STATE_CAN_SLEEP: {
+			r_snapshot.can_sleep = p_value;
+		} break;
+	}
+}
+
+void PhysicsServer3DWrapMT::_body_states_publish() {
+	// Runs on the server thread right after a step; the main thread only reads the front buffer.
+	LocalVector<BodyStateSnapshot> &back = body_states[body_states_front ^ 1];
+	back.resize(body_state_rids.size());
+
+	// Bodies freed since the last sync are already gone from the server, skip them.
+	HashSet<RID> removed;
+	{
+		MutexLock lock(body_state_mutex);
+		for (const RID &rid : body_state_pending_remove) {
+			removed.insert(rid);
+		}
+	}
+
+	for (uint32_t i = 0; i < body_state_rids.size(); i++) {
+		const RID &body = body_state_rids[i];
+		BodyStateSnapshot &snapshot = back[i];
+		if (unlikely(!removed.is_empty() && removed.has(body))) {
+			snapshot.published = false;
+			continue;
+		}
+		snapshot.transform = physics_server_3d->body_get_state(body, BODY_STATE_TRANSFORM);
+		snapshot.linear_velocity = physics_server_3d->body_get_state(body, BODY_STATE_LINEAR_VELOCITY);
+		snapshot.angular_velocity = physics_server_3d->body_get_state(body, BODY_STATE_ANGULAR_VELOCITY);
+		snapshot.sleeping = physics_server_3d->body_get_state(body, BODY_STATE_SLEEPING);
+		snapshot.can_sleep = physics_server_3d->body_get_state(body, BODY_STATE_CAN_SLEEP);
+		snapshot.published = true;
+	}
+}
+
+void PhysicsServer3DWrapMT::_body_states_swap() {
+	// Called from the main thread once the server thread has finished the step.
+	body_states_front ^= 1;
+
+	for (const BodyStateOverride &E : body_state_overrides) {
+		_body_state_write(body_states[body_states_front][E.slot], E.state, E.value);
+	}
+	body_state_overrides.clear();
+
+	// Apply layout changes now that both threads agree on it; new slots get
+	// filled by the next publish, until then reads go through the queue.
+	MutexLock lock(body_state_mutex);
+	for (const RID &rid : body_state_pending_remove) {
+		HashMap<RID, uint32_t>::Iterator E = body_state_slots.find(rid);
+		if (!E) {
+			continue;
+		}
+		uint32_t slot = E->value;
+		uint32_t last = body_state_rids.size() - 1;
+		if (slot != last) {
+			RID moved = body_state_rids[last];
+			body_state_rids[slot] = moved;
+			body_state_slots[moved] = slot;
+			for (LocalVector<BodyStateSnapshot> &states : body_states) {
+				states[slot] = states[last];
+			}
+		}
+		body_state_rids.resize(last);
+		for (LocalVector<BodyStateSnapshot> &states : body_states) {
+			states.resize(last);
+		}
+		body_state_slots.remove(E);
+	}
+	body_state_pending_remove.clear();
+
+	for (const RID &rid : body_state_pending_add) {
+		if (body_state_slots.has(rid)) {
+			continue;
+		}
+		body_state_slots.insert(rid, body_state_rids.size());
+		body_state_rids.push_back(rid);
+		for (LocalVector<BodyStateSnapshot> &states : body_states) {
+			states.push_back(BodyStateSnapshot());
+		}
+	}
+	body_state_pending_add.clear();
+}
+
+RID PhysicsServer3DWrapMT::body_create() {
+	RID body = physics_server_3d->body_create();
+	if (create_thread) {
+		MutexLock lock(body_state_mutex);
+		body_state_pending_add.push_back(body);
+	}
+	return body;
+}
+
+void PhysicsServer3DWrapMT::body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) {
+	if (Thread::get_caller_id() != server_thread) {
+		command_queue.push(physics_server_3d, &PhysicsServer3D::body_set_state, p_body, p_state, p_variant);
+		if (create_thread && Thread::is_main_thread()) {
+			// Write through so the main thread reads back its own changes before the next step publishes them.
+			HashMap<RID, uint32_t>::ConstIterator E = body_state_slots.find(p_body);
+			if (E && body_states[body_states_front][E->value].published) {
+				_body_state_write(body_states[body_states_front][E->value], p_state, p_variant);
+				BodyStateOverride entry;
+				entry.slot = E->value;
+				entry.state = p_state;
+				entry.value = p_variant;
+				body_state_overrides.push_back(entry);
+			}
+		}
+	} else {
+		command_queue.flush_if_pending();
+		physics_server_3d->body_set_state(p_body, p_state, p_variant);
+	}
+}
+
+Variant PhysicsServer3DWrapMT::body_get_state(RID p_body, BodyState p_state) const {
+	if (Thread::get_caller_id() != server_thread) {
+		if (create_thread && Thread::is_main_thread()) {
+			HashMap<RID, uint32_t>::ConstIterator E = body_state_slots.find(p_body);
+			if (E && body_states[body_states_front][E->value].published) {
+				const BodyStateSnapshot &snapshot = body_states[body_states_front][E->value];
+				switch (p_state) {
+					case BODY_STATE_TRANSFORM:
+						return snapshot.transform;
+					case BODY_STATE_LINEAR_VELOCITY:
+						return snapshot.linear_velocity;
+					case BODY_STATE_ANGULAR_VELOCITY:
+						return snapshot.angular_velocity;
+					case BODY_STATE_SLEEPING:
+						return snapshot.sleeping;
+					case BODY_STATE_CAN_SLEEP:
+						return snapshot.can_sleep;
+				}
+			}
+		}
+		Variant ret;
+		command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::body_get_state, p_body, p_state, &ret);
+		return ret;
+	} else {
+		command_queue.flush_if_pending();
+		return physics_server_3d->body_get_state(p_body, p_state);
+	}
+}
+
+void PhysicsServer3DWrapMT::free(RID p_rid) {
+	if (create_thread) {
+		MutexLock lock(body_state_mutex);
+		body_state_pending_remove.push_back(p_rid);
+	}
+	if (Thread::get_caller_id() != server_thread) {
+		command_queue.push(physics_server_3d, &PhysicsServer3D::free, p_rid);
+	} else {
+		command_queue.flush_if_pending();
+		physics_server_3d->free(p_rid);
+	}
+}
+
 /* EVENT QUEUING */
 
 void PhysicsServer3DWrapMT::step(real_t p_step) {
 	if (create_thread) {
-		command_queue.push(physics_server_3d, &PhysicsServer3D::step, p_step);
+		// Anything written from the main thread before this point is seen by the step and published with it.
+		body_state_overrides.clear();
+		command_queue.push(this, &PhysicsServer3DWrapMT::_thread_step, p_step);
 	} else {
 		physics_server_3d->step(p_step);
 	}
@@ -61,6 +241,7 @@ void PhysicsServer3DWrapMT::step(real_t p_step) {
 void PhysicsServer3DWrapMT::sync() {
 	if (create_thread) {
 		command_queue.sync();
+		_body_states_swap();
 	} else {
 		command_queue.flush_all(); // Flush all pending from other threads.
 	}
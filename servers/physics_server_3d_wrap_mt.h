@@ -33,8 +33,11 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "servers/physics_server_3d.h"
 
 #ifdef DEBUG_SYNC
@@ -61,6 +64,42 @@ class PhysicsServer3DWrapMT : public PhysicsServer3D {
 	bool exit = false;
 	bool create_thread = false;
 
+	// Body state published by the server thread at the end of every step,
+	// so the main thread can read transforms and velocities of the last
+	// completed step while the next one is still running.
+	struct BodyStateSnapshot {
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		bool sleeping = false;
+		bool can_sleep = true;
+		// False until a step has written this slot for its current body.
+		bool published = false;
+	};
+
+	struct BodyStateOverride {
+		uint32_t slot = 0;
+		BodyState state = BODY_STATE_TRANSFORM;
+		Variant value;
+	};
+
+	// Slot layout, only modified from the main thread in sync() while the server thread is idle.
+	LocalVector<RID> body_state_rids;
+	HashMap<RID, uint32_t> body_state_slots;
+	// Front buffer is read by the main thread, back buffer written by the server thread.
+	LocalVector<BodyStateSnapshot> body_states[2];
+	uint32_t body_states_front = 0;
+	// Main thread writes issued after the last step, re-applied when the buffers are swapped.
+	LocalVector<BodyStateOverride> body_state_overrides;
+
+	Mutex body_state_mutex;
+	LocalVector<RID> body_state_pending_add;
+	LocalVector<RID> body_state_pending_remove;
+
+	_FORCE_INLINE_ static void _body_state_write(BodyStateSnapshot &r_snapshot, BodyState p_state, const Variant &p_value);
+	void _body_states_publish();
+	void _body_states_swap();
+
 	void _assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id);
 	void _thread_exit();
 	void _thread_step(real_t p_delta);
@@ -171,7 +210,7 @@ public:
 	/* BODY API */
 
 	//FUNC2RID(body,BodyMode,bool);
-	FUNCRID(body)
+	virtual RID body_create() override;
 
 	FUNC2(body_set_space, RID, RID);
 	FUNC1RC(RID, body_get_space, RID);
@@ -215,8 +254,8 @@ public:
 
 	FUNC1(body_reset_mass_properties, RID);
 
-	FUNC3(body_set_state, RID, BodyState, const Variant &);
-	FUNC2RC(Variant, body_get_state, RID, BodyState);
+	virtual void body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) override;
+	virtual Variant body_get_state(RID p_body, BodyState p_state) const override;
 
 	FUNC2(body_apply_torque_impulse, RID, const Vector3 &);
 	FUNC2(body_apply_central_impulse, RID, const Vector3 &);
@@ -379,7 +418,7 @@ public:
 
 	/* MISC */
 
-	FUNC1(free, RID);
+	virtual void free(RID p_rid) override;
 	FUNC1(set_active, bool);
 
 	virtual void init() override;
@@ -55,6 +55,14 @@ public:
 		int ysort_parent_abs_z_index; // Absolute Z index of parent. Only populated and used when y-sorting.
 		uint32_t visibility_layer = 0xffffffff;
 
+		// Bounds of this item and its descendants in the item's local space, computed while culling.
+		// While nothing in the subtree changes, they allow skipping it entirely when off-screen.
+		Rect2 bounds_rect;
+		uint32_t bounds_cull_mask = 0;
+		uint64_t bounds_pass = 0;
+		bool bounds_valid = false;
+		bool bounds_dirty = true;
+
 		Vector<Item *> child_items;
 
 		struct VisibilityNotifierData {
@@ -175,6 +183,7 @@ public:
 	bool disable_scale;
 	bool sdf_used = false;
 	bool snapping_2d_transforms_to_pixel = false;
+	uint64_t current_bounds_pass = 0;
 
 	bool debug_redraw = false;
 	double debug_redraw_time = 0;
@@ -192,6 +201,8 @@ private:
 	void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int p_z);
 	int _count_ysort_children(RendererCanvasCull::Item *p_canvas_item);
 	void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner);
+	void _mark_bounds_dirty(RendererCanvasCull::Item *p_item);
+	void _update_item_bounds(Item *p_item, const Rect2 &p_rect, uint32_t p_canvas_cull_mask, bool p_cacheable);
 
 	static constexpr int z_range = RS::CANVAS_ITEM_Z_MAX - RS::CANVAS_ITEM_Z_MIN + 1;
 
@@ -821,7 +821,7 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 
 		bool cant_repeat = instance_data.flags & INSTANCE_DATA_FLAG_MULTIMESH || inst->mesh_instance.is_valid();
 
-		if (prev_surface != nullptr && !cant_repeat && prev_surface->sort.sort_key1 == surface->sort.sort_key1 && prev_surface->sort.sort_key2 == surface->sort.sort_key2 && inst->mirror == prev_surface->owner->mirror && repeats < RenderElementInfo::MAX_REPEATS) {
+		if (prev_surface != nullptr && !cant_repeat && RenderList::InstanceGroupKey::from_surface(prev_surface) == RenderList::InstanceGroupKey::from_surface(surface) && repeats < RenderElementInfo::MAX_REPEATS) {
 			//this element is the same as the previous one, count repeats to draw it using instancing
 			repeats++;
 		} else {
@@ -879,6 +879,10 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 		scene_state.used_lightmap = false;
 	}
 	uint32_t lightmap_captures_used = 0;
+	// Passes of a viewport, including its shadows, use its LOD caches as the hysteresis reference, only its color pass moves them.
+	uint32_t lod_cache_view = mesh_lod_cache_view_current;
+	uint32_t lod_cache_owner = lod_cache_view != UINT32_MAX ? mesh_lod_cache_views[lod_cache_view].owner : 0;
+	bool update_lod_cache = p_pass_mode == PASS_MODE_COLOR && lod_cache_view != UINT32_MAX;
 
 	Plane near_plane = Plane(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->scene_data->cam_transform.origin);
 	near_plane.d += p_render_data->scene_data->cam_projection.get_z_near();
@@ -1040,6 +1044,9 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 			lod_distance = surface_distance.length();
 		}
 
+		// Screen threshold converted to mesh units, shared by every surface of the instance.
+		float lod_max_edge_length = p_render_data->scene_data->screen_mesh_lod_threshold * lod_distance * p_render_data->scene_data->lod_distance_multiplier / (inst->lod_model_scale * inst->lod_bias);
+
 		while (surf) {
 			surf->sort.uses_forward_gi = 0;
 			surf->sort.uses_lightmap = 0;
@@ -1047,7 +1054,9 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 			// LOD
 			if (p_render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
 				uint32_t indices = 0;
-				surf->sort.lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, lod_distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
+				uint32_t no_lod_cache = UINT32_MAX;
+				uint32_t &lod_cache = lod_cache_view != UINT32_MAX ? surf->lod_cache.get(lod_cache_view, lod_cache_owner) : no_lod_cache;
+				surf->sort.lod_index = _mesh_surface_get_lod(surf->surface, lod_max_edge_length, update_lod_cache, lod_cache, indices);
 				if (p_render_data->render_info) {
 					indices = _indices_to_primitives(surf->primitive, indices);
 					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
@@ -1813,7 +1822,9 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 	_fill_render_list(RENDER_LIST_OPAQUE, p_render_data, PASS_MODE_COLOR, using_sdfgi, using_sdfgi || using_voxelgi, using_motion_pass);
 	render_list[RENDER_LIST_OPAQUE].sort_by_key();
+	render_list[RENDER_LIST_OPAQUE].group_instances();
 	render_list[RENDER_LIST_MOTION].sort_by_key();
+	render_list[RENDER_LIST_MOTION].group_instances();
 	render_list[RENDER_LIST_ALPHA].sort_by_reverse_depth_and_priority();
 
 	int *render_info = p_render_data->render_info ? p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE] : (int *)nullptr;
@@ -2677,6 +2688,7 @@ void RenderForwardClustered::_render_shadow_append(RID p_framebuffer, const Page
 	_fill_render_list(RENDER_LIST_SECONDARY, &render_data, pass_mode, false, false, false, true);
 	uint32_t render_list_size = render_list[RENDER_LIST_SECONDARY].elements.size() - render_list_from;
 	render_list[RENDER_LIST_SECONDARY].sort_by_key_range(render_list_from, render_list_size);
+	render_list[RENDER_LIST_SECONDARY].group_instances_range(render_list_from, render_list_size);
 	_fill_instance_data(RENDER_LIST_SECONDARY, p_render_info ? p_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW] : (int *)nullptr, render_list_from, render_list_size, false);
 
 	{
@@ -4512,12 +4524,15 @@ void RenderForwardClustered::_update_dirty_geometry_instances() {
 }
 
 void RenderForwardClustered::_update_dirty_geometry_pipelines() {
-	if (global_pipeline_data_required.key != global_pipeline_data_compiled.key) {
+	GlobalPipelineData global_pipeline_data = global_pipeline_data_required;
+	global_pipeline_data.key |= global_pipeline_data_prewarm.key;
+
+	if (global_pipeline_data.key != global_pipeline_data_compiled.key) {
 		// Go through the entire list of surfaces and compile pipelines for everything again.
 		SelfList<GeometryInstanceSurfaceDataCache> *list = geometry_surface_compilation_all_list.first();
 		while (list != nullptr) {
 			GeometryInstanceSurfaceDataCache *surface_cache = list->self();
-			_mesh_generate_all_pipelines_for_surface_cache(surface_cache, global_pipeline_data_required);
+			_mesh_generate_all_pipelines_for_surface_cache(surface_cache, global_pipeline_data);
 
 			if (surface_cache->compilation_dirty_element.in_list()) {
 				// Remove any elements from the dirty list as they don't need to be processed again.
@@ -4527,7 +4542,7 @@ void RenderForwardClustered::_update_dirty_geometry_pipelines() {
 			list = list->next();
 		}
 
-		global_pipeline_data_compiled.key = global_pipeline_data_required.key;
+		global_pipeline_data_compiled.key = global_pipeline_data.key;
 	} else {
 		// Compile pipelines only for the dirty list.
 		if (!geometry_surface_compilation_dirty_list.first()) {
@@ -4839,6 +4854,21 @@ RenderForwardClustered::RenderForwardClustered() {
 
 	_update_shader_quality_settings();
 
+	{
+		// Compile the pipelines for the features the previous session needed in the background, before the first frame that uses them.
+		// Only features enabled at run time are taken, the rest are derived from the project settings.
+		GlobalPipelineData previous_pipeline_data;
+		previous_pipeline_data.key = ShaderRD::get_usage_manifest_flags("RenderForwardClustered");
+		global_pipeline_data_prewarm.use_reflection_probes = previous_pipeline_data.use_reflection_probes;
+		global_pipeline_data_prewarm.use_separate_specular = previous_pipeline_data.use_separate_specular;
+		global_pipeline_data_prewarm.use_motion_vectors = previous_pipeline_data.use_motion_vectors;
+		global_pipeline_data_prewarm.use_normal_and_roughness = previous_pipeline_data.use_normal_and_roughness;
+		global_pipeline_data_prewarm.use_lightmaps = previous_pipeline_data.use_lightmaps;
+		global_pipeline_data_prewarm.use_voxelgi = previous_pipeline_data.use_voxelgi;
+		global_pipeline_data_prewarm.use_sdfgi = previous_pipeline_data.use_sdfgi;
+		global_pipeline_data_prewarm.use_multiview = previous_pipeline_data.use_multiview;
+	}
+
 	resolve_effects = memnew(RendererRD::Resolve());
 	taa = memnew(RendererRD::TAA);
 	fsr2_effect = memnew(RendererRD::FSR2Effect);
@@ -4846,6 +4876,8 @@ RenderForwardClustered::RenderForwardClustered() {
 }
 
 RenderForwardClustered::~RenderForwardClustered() {
+	ShaderRD::record_usage_manifest_flags("RenderForwardClustered", global_pipeline_data_required.key);
+
 	if (ss_effects != nullptr) {
 		memdelete(ss_effects);
 		ss_effects = nullptr;
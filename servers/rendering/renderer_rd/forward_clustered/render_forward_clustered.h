@@ -443,6 +443,7 @@ private:
 		uint32_t flags = 0;
 		uint32_t surface_index = 0;
 		uint32_t color_pass_inclusion_mask = 0;
+		MeshLODCache lod_cache; // LOD last used by each viewport, for hysteresis.
 
 		void *surface = nullptr;
 		RID material_uniform_set;
@@ -553,6 +554,7 @@ private:
 
 	GlobalPipelineData global_pipeline_data_compiled = {};
 	GlobalPipelineData global_pipeline_data_required = {};
+	GlobalPipelineData global_pipeline_data_prewarm = {};
 
 	typedef Pair<SceneShaderForwardClustered::ShaderData *, SceneShaderForwardClustered::ShaderData::PipelineKey> ShaderPipelinePair;
 
@@ -597,6 +599,94 @@ private:
 			sorter.sort(elements.ptr() + p_from, p_size);
 		}
 
+		// Surfaces that can be drawn with a single instanced draw call share the same key,
+		// the depth layer is ignored so repeated props spread over the view can be merged.
+		struct InstanceGroupKey {
+			uint64_t sort_key1 = 0;
+			uint64_t sort_key2 = 0;
+			bool mirror = false;
+
+			static _FORCE_INLINE_ InstanceGroupKey from_surface(const GeometryInstanceSurfaceDataCache *p_surface) {
+				InstanceGroupKey key;
+				decltype(p_surface->sort) sort = p_surface->sort;
+				sort.depth_layer = 0;
+				key.sort_key1 = sort.sort_key1;
+				key.sort_key2 = sort.sort_key2;
+				key.mirror = p_surface->owner->mirror;
+				return key;
+			}
+
+			_FORCE_INLINE_ bool operator==(const InstanceGroupKey &p_key) const {
+				return sort_key1 == p_key.sort_key1 && sort_key2 == p_key.sort_key2 && mirror == p_key.mirror;
+			}
+
+			static _FORCE_INLINE_ uint32_t hash(const InstanceGroupKey &p_key) {
+				uint32_t h = hash_murmur3_one_64(p_key.sort_key1);
+				h = hash_murmur3_one_64(p_key.sort_key2, h);
+				h = hash_murmur3_one_32(p_key.mirror, h);
+				return hash_fmix32(h);
+			}
+		};
+
+		HashMap<InstanceGroupKey, uint32_t, InstanceGroupKey> instance_group_map;
+		LocalVector<uint32_t> instance_group_offsets;
+		LocalVector<uint32_t> element_instance_groups;
+		LocalVector<GeometryInstanceSurfaceDataCache *> grouped_elements;
+
+		// Must be called after sorting by key. Moves every surface next to the first surface
+		// it can be instanced with, keeping groups in the order they first appear so the
+		// front to back and priority ordering of the sorted list is mostly preserved.
+		void group_instances_range(uint32_t p_from, uint32_t p_size) {
+			if (p_size < 2) {
+				return;
+			}
+
+			instance_group_map.clear();
+			instance_group_offsets.clear();
+			element_instance_groups.resize(p_size);
+
+			GeometryInstanceSurfaceDataCache **ptr = elements.ptr() + p_from;
+			uint32_t runs = 0;
+			for (uint32_t i = 0; i < p_size; i++) {
+				InstanceGroupKey key = InstanceGroupKey::from_surface(ptr[i]);
+				uint32_t *group = instance_group_map.getptr(key);
+				uint32_t group_index;
+				if (group) {
+					group_index = *group;
+				} else {
+					group_index = instance_group_offsets.size();
+					instance_group_map.insert(key, group_index);
+					instance_group_offsets.push_back(0);
+				}
+				instance_group_offsets[group_index]++;
+				element_instance_groups[i] = group_index;
+				if (i == 0 || element_instance_groups[i - 1] != group_index) {
+					runs++;
+				}
+			}
+
+			if (runs == instance_group_offsets.size()) {
+				return; // Every group is already contiguous.
+			}
+
+			uint32_t offset = 0;
+			for (uint32_t &group_offset : instance_group_offsets) {
+				uint32_t count = group_offset;
+				group_offset = offset;
+				offset += count;
+			}
+
+			grouped_elements.resize(p_size);
+			for (uint32_t i = 0; i < p_size; i++) {
+				grouped_elements[instance_group_offsets[element_instance_groups[i]]++] = ptr[i];
+			}
+			memcpy(ptr, grouped_elements.ptr(), sizeof(GeometryInstanceSurfaceDataCache *) * p_size);
+		}
+
+		void group_instances() {
+			group_instances_range(0, elements.size());
+		}
+
 		struct SortByDepth {
 			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
 				return (A->owner->depth < B->owner->depth);
@@ -141,9 +141,11 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 
 	actions.uniforms = &uniforms;
 
-	MutexLock lock(SceneShaderForwardClustered::singleton_mutex);
+	// The compiler is thread-safe, only the shader versions need the lock.
 	Error err = SceneShaderForwardClustered::singleton->compiler.compile(RS::SHADER_SPATIAL, code, &actions, path, gen_code);
 
+	MutexLock lock(SceneShaderForwardClustered::singleton_mutex);
+
 	if (err != OK) {
 		if (version.is_valid()) {
 			SceneShaderForwardClustered::singleton->shader.version_free(version);
@@ -1895,6 +1895,10 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 		scene_state.used_lightmap = false;
 	}
 	uint32_t lightmap_captures_used = 0;
+	// Passes of a viewport, including its shadows, use its LOD caches as the hysteresis reference, only its color pass moves them.
+	uint32_t lod_cache_view = mesh_lod_cache_view_current;
+	uint32_t lod_cache_owner = lod_cache_view != UINT32_MAX ? mesh_lod_cache_views[lod_cache_view].owner : 0;
+	bool update_lod_cache = p_pass_mode == PASS_MODE_COLOR && lod_cache_view != UINT32_MAX;
 
 	Plane near_plane(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->scene_data->cam_transform.origin);
 	near_plane.d += p_render_data->scene_data->cam_projection.get_z_near();
@@ -1995,6 +1999,9 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 			lod_distance = surface_distance.length();
 		}
 
+		// Screen threshold converted to mesh units, shared by every surface of the instance.
+		float lod_max_edge_length = p_render_data->scene_data->screen_mesh_lod_threshold * lod_distance * p_render_data->scene_data->lod_distance_multiplier / (inst->lod_model_scale * inst->lod_bias);
+
 		while (surf) {
 			surf->sort.uses_lightmap = 0;
 
@@ -2002,7 +2009,9 @@ void RenderForwardMobile::_fill_render_list(RenderListType p_render_list, const
 
 			if (p_render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
 				uint32_t indices = 0;
-				surf->lod_index = mesh_storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, lod_distance * p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, indices);
+				uint32_t no_lod_cache = UINT32_MAX;
+				uint32_t &lod_cache = lod_cache_view != UINT32_MAX ? surf->lod_cache.get(lod_cache_view, lod_cache_owner) : no_lod_cache;
+				surf->lod_index = _mesh_surface_get_lod(surf->surface, lod_max_edge_length, update_lod_cache, lod_cache, indices);
 				if (p_render_data->render_info) {
 					indices = _indices_to_primitives(surf->primitive, indices);
 					if (p_render_list == RENDER_LIST_OPAQUE) { //opaque
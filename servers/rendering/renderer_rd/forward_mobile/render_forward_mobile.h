@@ -424,6 +424,7 @@ protected:
 		uint32_t flags = 0;
 		uint32_t surface_index = 0;
 		uint32_t lod_index = 0;
+		MeshLODCache lod_cache; // LOD last used by each viewport, for hysteresis.
 
 		void *surface = nullptr;
 		RID material_uniform_set;
@@ -1514,9 +1514,11 @@ void RendererCanvasRenderRD::CanvasShaderData::set_code(const String &p_code) {
 	actions.uniforms = &uniforms;
 
 	RendererCanvasRenderRD *canvas_singleton = static_cast<RendererCanvasRenderRD *>(RendererCanvasRender::singleton);
-	MutexLock lock(canvas_singleton->shader.mutex);
 
+	// The compiler is thread-safe, only the shader versions need the lock.
 	Error err = canvas_singleton->shader.compiler.compile(RS::SHADER_CANVAS_ITEM, code, &actions, path, gen_code);
+
+	MutexLock lock(canvas_singleton->shader.mutex);
 	if (err != OK) {
 		if (version.is_valid()) {
 			canvas_singleton->shader.canvas_shader.version_free(version);
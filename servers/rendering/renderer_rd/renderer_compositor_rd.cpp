@@ -169,6 +169,9 @@ void RendererCompositorRD::finalize() {
 	memdelete(texture_storage);
 	memdelete(utilities);
 
+	// Written after the scene renderer is freed, as it records the features it used when it's destroyed.
+	ShaderRD::save_usage_manifest();
+
 	//only need to erase these, the rest are erased by cascade
 	blit.shader.version_free(blit.shader_version);
 	RD::get_singleton()->free(blit.index_buffer);
@@ -309,6 +312,11 @@ RendererCompositorRD::RendererCompositorRD() {
 					ShaderRD::set_shader_cache_save_compressed(compress);
 					ShaderRD::set_shader_cache_save_compressed_zstd(use_zstd);
 					ShaderRD::set_shader_cache_save_debug(!strip_debug);
+
+					bool usage_manifest = GLOBAL_GET("rendering/shader_compiler/shader_cache/usage_manifest");
+					if (usage_manifest) {
+						ShaderRD::set_usage_manifest_path(shader_cache_dir.path_join("usage_manifest.txt"));
+					}
 				}
 			}
 		}
@@ -350,4 +358,5 @@ RendererCompositorRD::~RendererCompositorRD() {
 	memdelete(uniform_set_cache);
 	memdelete(framebuffer_cache);
 	ShaderRD::set_shader_cache_dir(String());
+	ShaderRD::set_usage_manifest_path(String());
 }
@@ -39,6 +39,7 @@
 #include "servers/rendering/renderer_rd/shaders/light_data_inc.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/scene_data_inc.glsl.gen.h"
 #include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
+#include "servers/rendering/renderer_rd/storage_rd/mesh_storage.h"
 #include "servers/rendering/renderer_rd/storage_rd/texture_storage.h"
 #include "servers/rendering/rendering_server_default.h"
 #include "servers/rendering/shader_include_db.h"
@@ -770,6 +771,56 @@ void RendererSceneRenderRD::_disable_clear_request(const RenderDataRD *p_render_
 	texture_storage->render_target_disable_clear_request(p_render_data->render_buffers->get_render_target());
 }
 
+uint32_t RendererSceneRenderRD::_get_mesh_lod_cache_view(RID p_render_target) {
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+	uint32_t free_view = UINT32_MAX;
+	for (uint32_t i = 0; i < MESH_LOD_CACHE_VIEWS; i++) {
+		MeshLODCacheView &view = mesh_lod_cache_views[i];
+		if (view.render_target == p_render_target) {
+			view.last_frame = frame;
+			return i;
+		}
+		// Slots of viewports that did not render last frame can be taken over.
+		if (free_view == UINT32_MAX && (view.render_target.is_null() || view.last_frame + 1 < frame)) {
+			free_view = i;
+		}
+	}
+
+	if (free_view != UINT32_MAX) {
+		mesh_lod_cache_views[free_view].render_target = p_render_target;
+		mesh_lod_cache_views[free_view].last_frame = frame;
+		mesh_lod_cache_views[free_view].owner = ++mesh_lod_cache_owners;
+	}
+	return free_view;
+}
+
+uint32_t RendererSceneRenderRD::_mesh_surface_get_lod(void *p_surface, float p_max_edge_length, bool p_update_cache, uint32_t &r_lod_cache, uint32_t &r_index_count) {
+	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+
+	uint32_t lod = mesh_storage->mesh_surface_get_lod(p_surface, p_max_edge_length, r_index_count, r_lod_cache, mesh_lod_hysteresis);
+	if (!p_update_cache || lod == r_lod_cache) {
+		return lod;
+	}
+
+	// Surfaces seen for the first time are not limited, so a freshly loaded scene does not start at full detail.
+	if (mesh_lod_max_changes_per_frame > 0 && r_lod_cache != UINT32_MAX) {
+		uint64_t frame = RSG::rasterizer->get_frame_number();
+		if (mesh_lod_changes_frame != frame) {
+			mesh_lod_changes_frame = frame;
+			mesh_lod_changes_left = mesh_lod_max_changes_per_frame;
+		}
+
+		if (mesh_lod_changes_left == 0) {
+			r_index_count = mesh_storage->mesh_surface_get_lod_index_count(p_surface, r_lod_cache);
+			return r_lod_cache;
+		}
+		mesh_lod_changes_left--;
+	}
+
+	r_lod_cache = lod;
+	return lod;
+}
+
 bool RendererSceneRenderRD::_debug_draw_can_use_effects(RS::ViewportDebugDraw p_debug_draw) {
 	bool can_use_effects = true;
 	switch (p_debug_draw) {
@@ -1245,8 +1296,15 @@ void RendererSceneRenderRD::render_scene(const Ref<RenderSceneBuffers> &p_render
 		clear_color = RSG::texture_storage->get_default_clear_color();
 	}
 
+	// Shadow passes have no render buffers, they find the viewport's LOD caches through the current slot.
+	if (p_render_buffers.is_valid() && p_reflection_probe.is_null()) {
+		mesh_lod_cache_view_current = _get_mesh_lod_cache_view(rb->get_render_target());
+	}
+
 	//calls _pre_opaque_render between depth pre-pass and opaque pass
 	_render_scene(&render_data, clear_color);
+
+	mesh_lod_cache_view_current = UINT32_MAX;
 }
 
 void RendererSceneRenderRD::render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) {
@@ -1492,6 +1550,8 @@ void RendererSceneRenderRD::init() {
 	screen_space_roughness_limiter_amount = GLOBAL_GET("rendering/anti_aliasing/screen_space_roughness_limiter/amount");
 	screen_space_roughness_limiter_limit = GLOBAL_GET("rendering/anti_aliasing/screen_space_roughness_limiter/limit");
 	glow_bicubic_upscale = int(GLOBAL_GET("rendering/environment/glow/upscale_mode")) > 0;
+	mesh_lod_hysteresis = GLOBAL_GET("rendering/mesh_lod/lod_change/hysteresis");
+	mesh_lod_max_changes_per_frame = GLOBAL_GET("rendering/mesh_lod/lod_change/max_changes_per_frame");
 
 	directional_penumbra_shadow_kernel = memnew_arr(float, 128);
 	directional_soft_shadow_kernel = memnew_arr(float, 128);
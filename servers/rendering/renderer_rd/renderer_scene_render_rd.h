@@ -76,6 +76,46 @@ protected:
 
 	bool use_physical_light_units = false;
 
+	/* MESH LOD */
+
+	float mesh_lod_hysteresis = 0.0;
+	uint32_t mesh_lod_max_changes_per_frame = 0;
+	uint32_t mesh_lod_changes_left = 0;
+	uint64_t mesh_lod_changes_frame = 0;
+
+	// Surfaces keep one LOD cache per viewport, so cameras rendering the same scene don't overwrite each other's.
+	static constexpr uint32_t MESH_LOD_CACHE_VIEWS = 4;
+	struct MeshLODCacheView {
+		RID render_target;
+		uint64_t last_frame = 0;
+		uint32_t owner = 0; // Changes every time the slot is taken over by another viewport.
+	};
+	MeshLODCacheView mesh_lod_cache_views[MESH_LOD_CACHE_VIEWS];
+	uint32_t mesh_lod_cache_owners = 0;
+	// Slot of the viewport render_scene() is drawing, also used by the shadow passes it renders. UINT32_MAX outside of it.
+	uint32_t mesh_lod_cache_view_current = UINT32_MAX;
+
+	// LOD last used by a surface in each slot. It is reset when the slot changes owner, so a viewport doesn't start from another one's LODs.
+	struct MeshLODCache {
+		uint32_t lod[MESH_LOD_CACHE_VIEWS] = { UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX };
+		uint32_t owner[MESH_LOD_CACHE_VIEWS] = {};
+
+		_FORCE_INLINE_ uint32_t &get(uint32_t p_view, uint32_t p_owner) {
+			if (owner[p_view] != p_owner) {
+				owner[p_view] = p_owner;
+				lod[p_view] = UINT32_MAX;
+			}
+			return lod[p_view];
+		}
+	};
+
+	// Returns the LOD cache slot of the viewport rendering to p_render_target, or UINT32_MAX if all slots are in use.
+	uint32_t _get_mesh_lod_cache_view(RID p_render_target);
+
+	// Selects the LOD of a surface. r_lod_cache holds the LOD last used by the viewport, changes away from it are
+	// damped by the hysteresis band and, when p_update_cache is set, limited by the per frame change budget.
+	uint32_t _mesh_surface_get_lod(void *p_surface, float p_max_edge_length, bool p_update_cache, uint32_t &r_lod_cache, uint32_t &r_index_count);
+
 	////////////////////////////////
 
 	virtual RendererRD::ForwardIDStorage *create_forward_id_storage() { return memnew(RendererRD::ForwardIDStorage); }
@@ -558,7 +558,9 @@ void ShaderRD::_compile_version_start(Version *p_version, int p_group) {
 	compile_data.version = p_version;
 	compile_data.group = p_group;
 
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, compile_data, group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
+	// Groups only enabled because of the usage manifest aren't needed yet, so they don't compete with the ones that are.
+	bool high_priority = !group_prewarm[p_group];
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, compile_data, group_to_variant_map[p_group].size(), -1, high_priority, SNAME("ShaderCompilation"));
 	p_version->group_compilation_tasks.write[p_group] = group_task;
 }
 
@@ -731,8 +733,11 @@ bool ShaderRD::is_variant_enabled(int p_variant) const {
 void ShaderRD::enable_group(int p_group) {
 	ERR_FAIL_INDEX(p_group, group_enabled.size());
 
+	_record_group_usage(p_group);
+
 	if (group_enabled[p_group]) {
-		// Group already enabled, do nothing.
+		// Group already enabled, do nothing. If it was enabled ahead of time by the usage manifest, it's needed from now on.
+		group_prewarm.write[p_group] = false;
 		return;
 	}
 
@@ -791,6 +796,8 @@ void ShaderRD::initialize(const Vector<String> &p_variant_defines, const String
 		group_sha256.resize(1);
 		_initialize_cache();
 	}
+
+	_apply_usage_manifest();
 }
 
 void ShaderRD::_initialize_cache() {
@@ -872,6 +879,103 @@ void ShaderRD::initialize(const Vector<VariantDefine> &p_variant_defines, const
 		group_sha256.resize(max_group_id + 1);
 		_initialize_cache();
 	}
+
+	_apply_usage_manifest();
+}
+
+void ShaderRD::_apply_usage_manifest() {
+	group_prewarm.resize_zeroed(group_enabled.size());
+	group_usage_recorded.resize_zeroed(group_enabled.size());
+
+	MutexLock lock(usage_manifest_mutex);
+	for (int i = 0; i < group_enabled.size(); i++) {
+		if (!group_enabled[i] && usage_manifest_groups.has(name + " " + itos(i))) {
+			// The previous session enabled this group at run time. Enable it now so the versions created from now on
+			// compile it in the background, instead of all of them compiling it at once when it's first needed.
+			group_enabled.write[i] = true;
+			group_prewarm.write[i] = true;
+		}
+	}
+}
+
+void ShaderRD::_record_group_usage(int p_group) {
+	if (usage_manifest_path.is_empty() || group_usage_recorded[p_group]) {
+		return;
+	}
+
+	group_usage_recorded.write[p_group] = true;
+
+	MutexLock lock(usage_manifest_mutex);
+	usage_recorded_groups.insert(name + " " + itos(p_group));
+}
+
+void ShaderRD::set_usage_manifest_path(const String &p_path) {
+	MutexLock lock(usage_manifest_mutex);
+	usage_manifest_path = p_path;
+	usage_manifest_groups.clear();
+	usage_manifest_flags.clear();
+	usage_recorded_groups.clear();
+	usage_recorded_flags.clear();
+
+	if (usage_manifest_path.is_empty() || !FileAccess::exists(usage_manifest_path)) {
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(usage_manifest_path, FileAccess::READ);
+	ERR_FAIL_COND(f.is_null());
+
+	// Each line is "group <shader name> <group>" or "flags <key> <hexadecimal flags>".
+	while (!f->eof_reached()) {
+		String line = f->get_line().strip_edges();
+		if (line.get_slice_count(" ") != 3) {
+			continue;
+		}
+
+		const String type = line.get_slice(" ", 0);
+		const String key = line.get_slice(" ", 1);
+		const String value = line.get_slice(" ", 2);
+		if (type == "group" && value.is_valid_int()) {
+			usage_manifest_groups.insert(key + " " + value);
+		} else if (type == "flags" && value.is_valid_hex_number(false)) {
+			usage_manifest_flags[key] = value.hex_to_int();
+		}
+	}
+
+	print_verbose(vformat("Loaded shader usage manifest with %d groups: %s", usage_manifest_groups.size(), usage_manifest_path));
+}
+
+void ShaderRD::save_usage_manifest() {
+	MutexLock lock(usage_manifest_mutex);
+	if (usage_manifest_path.is_empty()) {
+		return;
+	}
+
+	// Only what this session used is written, so groups and features that stop being used are eventually no longer compiled ahead of time.
+	Ref<FileAccess> f = FileAccess::open(usage_manifest_path, FileAccess::WRITE);
+	ERR_FAIL_COND(f.is_null());
+
+	for (const String &E : usage_recorded_groups) {
+		f->store_line("group " + E);
+	}
+
+	for (const KeyValue<String, uint32_t> &E : usage_recorded_flags) {
+		f->store_line("flags " + E.key + " " + String::num_uint64(E.value, 16));
+	}
+}
+
+uint32_t ShaderRD::get_usage_manifest_flags(const String &p_key) {
+	MutexLock lock(usage_manifest_mutex);
+	HashMap<String, uint32_t>::ConstIterator E = usage_manifest_flags.find(p_key);
+	return E ? E->value : 0;
+}
+
+void ShaderRD::record_usage_manifest_flags(const String &p_key, uint32_t p_flags) {
+	MutexLock lock(usage_manifest_mutex);
+	if (usage_manifest_path.is_empty() || p_flags == 0) {
+		return;
+	}
+
+	usage_recorded_flags[p_key] |= p_flags;
 }
 
 void ShaderRD::set_shader_cache_dir(const String &p_dir) {
@@ -894,6 +998,12 @@ String ShaderRD::shader_cache_dir;
 bool ShaderRD::shader_cache_save_compressed = true;
 bool ShaderRD::shader_cache_save_compressed_zstd = true;
 bool ShaderRD::shader_cache_save_debug = true;
+String ShaderRD::usage_manifest_path;
+Mutex ShaderRD::usage_manifest_mutex;
+HashSet<String> ShaderRD::usage_manifest_groups;
+HashMap<String, uint32_t> ShaderRD::usage_manifest_flags;
+HashSet<String> ShaderRD::usage_recorded_groups;
+HashMap<String, uint32_t> ShaderRD::usage_recorded_flags;
 
 ShaderRD::~ShaderRD() {
 	List<RID> remaining;
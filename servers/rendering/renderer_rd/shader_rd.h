@@ -34,6 +34,7 @@
 #include "core/os/mutex.h"
 #include "core/string/string_builder.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/rid_owner.h"
@@ -62,6 +63,8 @@ private:
 	Vector<uint32_t> variant_to_group;
 	HashMap<int, LocalVector<int>> group_to_variant_map;
 	Vector<bool> group_enabled;
+	Vector<bool> group_prewarm;
+	Vector<bool> group_usage_recorded;
 
 	Vector<RD::PipelineImmutableSampler> immutable_samplers;
 
@@ -154,6 +157,16 @@ private:
 	void _save_to_cache(Version *p_version, int p_group);
 	void _initialize_cache();
 
+	static String usage_manifest_path;
+	static Mutex usage_manifest_mutex;
+	static HashSet<String> usage_manifest_groups;
+	static HashMap<String, uint32_t> usage_manifest_flags;
+	static HashSet<String> usage_recorded_groups;
+	static HashMap<String, uint32_t> usage_recorded_flags;
+
+	void _apply_usage_manifest();
+	void _record_group_usage(int p_group);
+
 protected:
 	ShaderRD();
 	void setup(const char *p_vertex_code, const char *p_fragment_code, const char *p_compute_code, const char *p_name);
@@ -211,6 +224,12 @@ public:
 	static void set_shader_cache_save_compressed_zstd(bool p_enable);
 	static void set_shader_cache_save_debug(bool p_enable);
 
+	// The usage manifest records the groups and renderer features a session needed, so the next session can compile them ahead of time.
+	static void set_usage_manifest_path(const String &p_path);
+	static void save_usage_manifest();
+	static uint32_t get_usage_manifest_flags(const String &p_key);
+	static void record_usage_manifest_flags(const String &p_key, uint32_t p_flags);
+
 	RS::ShaderNativeSourceCode version_get_native_source_code(RID p_version);
 
 	void initialize(const Vector<String> &p_variant_defines, const String &p_general_defines = "", const Vector<RD::PipelineImmutableSampler> &r_immutable_samplers = Vector<RD::PipelineImmutableSampler>());
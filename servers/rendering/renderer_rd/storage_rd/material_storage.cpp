@@ -32,6 +32,8 @@
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/io/resource_loader.h"
+#include "core/object/worker_thread_pool.h"
+#include "servers/rendering/rendering_server_globals.h"
 #include "servers/rendering/storage/variant_converters.h"
 #include "texture_storage.h"
 
@@ -1573,6 +1575,7 @@ void MaterialStorage::global_shader_parameter_add(const StringName &p_name, RS::
 	}
 
 	global_shader_uniforms.variables[p_name] = gv;
+	global_shader_uniforms.must_recompile_shaders = true;
 }
 
 void MaterialStorage::global_shader_parameter_remove(const StringName &p_name) {
@@ -1589,6 +1592,7 @@ void MaterialStorage::global_shader_parameter_remove(const StringName &p_name) {
 	}
 
 	global_shader_uniforms.variables.erase(p_name);
+	global_shader_uniforms.must_recompile_shaders = true;
 }
 
 Vector<StringName> MaterialStorage::global_shader_parameter_get_list() const {
@@ -1875,6 +1879,11 @@ void MaterialStorage::_update_global_shader_uniforms() {
 		global_shader_uniforms.buffer_dirty_region_count = 0;
 	}
 
+	if (global_shader_uniforms.must_recompile_shaders) {
+		_recompile_shaders_using_global_uniforms();
+		global_shader_uniforms.must_recompile_shaders = false;
+	}
+
 	if (global_shader_uniforms.must_update_buffer_materials) {
 		// only happens in the case of a buffer variable added or removed,
 		// so not often.
@@ -1902,6 +1911,45 @@ void MaterialStorage::_update_global_shader_uniforms() {
 	}
 }
 
+void MaterialStorage::_shader_recompile_threaded(uint32_t p_index, Shader **p_shaders) {
+	Shader *shader = p_shaders[p_index];
+	shader->data->set_code(shader->code);
+}
+
+void MaterialStorage::_recompile_shaders_using_global_uniforms() {
+	// The type of global parameters is resolved when compiling, and shaders using one that did not exist failed
+	// to compile, so adding or removing parameters compiles every shader that may use them again.
+	LocalVector<Shader *> shaders;
+	List<RID> shader_rids;
+	shader_owner.get_owned_list(&shader_rids);
+	for (const RID &E : shader_rids) {
+		Shader *shader = shader_owner.get_or_null(E);
+		if (shader && shader->data && shader->may_use_global_uniforms) {
+			shaders.push_back(shader);
+		}
+	}
+	if (shaders.is_empty()) {
+		return;
+	}
+
+	// Shaders are only compiled in parallel when the renderer allows it, as shader_create_from_code() does.
+	if (shaders.size() > 1 && RSG::rasterizer->can_create_resources_async()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &MaterialStorage::_shader_recompile_threaded, shaders.ptr(), shaders.size(), -1, true, SNAME("RecompileShaders"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < shaders.size(); i++) {
+			_shader_recompile_threaded(i, shaders.ptr());
+		}
+	}
+
+	for (Shader *shader : shaders) {
+		for (Material *material : shader->owners) {
+			material->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_MATERIAL);
+			_material_queue_update(material, true, true);
+		}
+	}
+}
+
 /* SHADER API */
 
 RID MaterialStorage::shader_allocate() {
@@ -1937,6 +1985,8 @@ void MaterialStorage::shader_set_code(RID p_shader, const String &p_code) {
 	ERR_FAIL_NULL(shader);
 
 	shader->code = p_code;
+	// Conservative, a false positive only costs a compilation when global parameters are added or removed.
+	shader->may_use_global_uniforms = p_code.contains("global");
 	String mode_string = ShaderLanguage::get_shader_type(p_code);
 
 	ShaderType new_type;
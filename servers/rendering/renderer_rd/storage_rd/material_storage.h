@@ -202,6 +202,7 @@ private:
 
 		bool must_update_texture_materials = false;
 		bool must_update_buffer_materials = false;
+		bool must_recompile_shaders = false;
 
 		HashMap<RID, int32_t> instance_buffer_pos;
 	} global_shader_uniforms;
@@ -221,6 +222,7 @@ private:
 		ShaderType type;
 		HashMap<StringName, HashMap<int, RID>> default_texture_parameter;
 		HashSet<Material *> owners;
+		bool may_use_global_uniforms = false;
 	};
 
 	typedef ShaderData *(*ShaderDataRequestFunction)();
@@ -382,6 +384,8 @@ public:
 	/* GLOBAL SHADER UNIFORM API */
 
 	void _update_global_shader_uniforms();
+	void _shader_recompile_threaded(uint32_t p_index, Shader **p_shaders);
+	void _recompile_shaders_using_global_uniforms();
 
 	virtual void global_shader_parameter_add(const StringName &p_name, RS::GlobalShaderParameterType p_type, const Variant &p_value) override;
 	virtual void global_shader_parameter_remove(const StringName &p_name) override;
@@ -453,24 +453,34 @@ public:
 		return s->uv_scale;
 	}
 
-	_FORCE_INLINE_ uint32_t mesh_surface_get_lod(void *p_surface, float p_model_scale, float p_distance_threshold, float p_mesh_lod_threshold, uint32_t &r_index_count) const {
+	// Returns the most detailed LOD whose edge length does not exceed p_max_edge_length (0 is the base mesh).
+	_FORCE_INLINE_ uint32_t _mesh_surface_find_lod(const Mesh::Surface *p_surface, float p_max_edge_length) const {
+		uint32_t lod = 0;
+		while (lod < p_surface->lod_count && !(p_surface->lods[lod].edge_length > p_max_edge_length)) {
+			lod++;
+		}
+		return lod;
+	}
+
+	// p_max_edge_length is the screen threshold converted to mesh units, it only depends on the instance
+	// so it should be computed once for all its surfaces. When p_hysteresis is above zero, p_current_lod
+	// is kept as long as the threshold stays within the hysteresis band around it.
+	_FORCE_INLINE_ uint32_t mesh_surface_get_lod(void *p_surface, float p_max_edge_length, uint32_t &r_index_count, uint32_t p_current_lod = UINT32_MAX, float p_hysteresis = 0.0) const {
 		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
 
-		int32_t current_lod = -1;
-		r_index_count = s->index_count;
-		for (uint32_t i = 0; i < s->lod_count; i++) {
-			float screen_size = s->lods[i].edge_length * p_model_scale / p_distance_threshold;
-			if (screen_size > p_mesh_lod_threshold) {
-				break;
-			}
-			current_lod = i;
-		}
-		if (current_lod == -1) {
-			return 0;
-		} else {
-			r_index_count = s->lods[current_lod].index_count;
-			return current_lod + 1;
+		uint32_t lod = _mesh_surface_find_lod(s, p_max_edge_length);
+		if (p_hysteresis > 0.0 && p_current_lod != lod && p_current_lod <= s->lod_count) {
+			uint32_t finest_lod = _mesh_surface_find_lod(s, p_max_edge_length * (1.0 - p_hysteresis));
+			uint32_t coarsest_lod = _mesh_surface_find_lod(s, p_max_edge_length * (1.0 + p_hysteresis));
+			lod = CLAMP(p_current_lod, finest_lod, coarsest_lod);
 		}
+		r_index_count = mesh_surface_get_lod_index_count(p_surface, lod);
+		return lod;
+	}
+
+	_FORCE_INLINE_ uint32_t mesh_surface_get_lod_index_count(void *p_surface, uint32_t p_lod) const {
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+		return p_lod == 0 ? s->index_count : s->lods[p_lod - 1].index_count;
 	}
 
 	_FORCE_INLINE_ RID mesh_surface_get_index_array(void *p_surface, uint32_t p_lod) const {
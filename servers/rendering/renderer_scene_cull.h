@@ -254,6 +254,87 @@ public:
 		}
 	};
 
+	struct InstanceBoundsSoA {
+		// Same bounds as InstanceBounds, but with one array per component
+		// so the camera frustum can be tested for a whole block of instances at once.
+		// Arrays are padded to a multiple of BLOCK_SIZE, lanes past the end hold an inverted
+		// AABB (minimum at +INF, maximum at -INF) that is outside of every plane.
+
+		static const uint32_t BLOCK_SIZE = 8;
+
+		LocalVector<real_t> components[6];
+		uint32_t count = 0;
+
+		_ALWAYS_INLINE_ void set(uint32_t p_index, const AABB &p_aabb) {
+			components[0][p_index] = p_aabb.position.x;
+			components[1][p_index] = p_aabb.position.y;
+			components[2][p_index] = p_aabb.position.z;
+			components[3][p_index] = p_aabb.position.x + p_aabb.size.x;
+			components[4][p_index] = p_aabb.position.y + p_aabb.size.y;
+			components[5][p_index] = p_aabb.position.z + p_aabb.size.z;
+		}
+		_ALWAYS_INLINE_ void set_empty(uint32_t p_index) {
+			for (int i = 0; i < 3; i++) {
+				components[i][p_index] = INFINITY;
+				components[i + 3][p_index] = -INFINITY;
+			}
+		}
+		_ALWAYS_INLINE_ void push_back(const AABB &p_aabb) {
+			if (count == components[0].size()) {
+				for (int i = 0; i < 6; i++) {
+					components[i].resize(count + BLOCK_SIZE);
+				}
+				for (uint32_t i = count + 1; i < count + BLOCK_SIZE; i++) {
+					set_empty(i);
+				}
+			}
+			set(count++, p_aabb);
+		}
+		_ALWAYS_INLINE_ void copy(uint32_t p_to, uint32_t p_from) {
+			for (int i = 0; i < 6; i++) {
+				components[i][p_to] = components[i][p_from];
+			}
+		}
+		_ALWAYS_INLINE_ void pop_back() {
+			set_empty(--count);
+		}
+		void reset() {
+			for (int i = 0; i < 6; i++) {
+				components[i].reset();
+			}
+			count = 0;
+		}
+
+		// Returns a bit mask of the instances in [p_block_from, p_block_from + BLOCK_SIZE) inside the frustum,
+		// using the same test as InstanceBounds::in_frustum(). p_block_from must be a multiple of BLOCK_SIZE.
+		_ALWAYS_INLINE_ uint32_t in_frustum_block(uint32_t p_block_from, const Frustum &p_frustum) const {
+			uint8_t inside[BLOCK_SIZE];
+			for (uint32_t j = 0; j < BLOCK_SIZE; j++) {
+				inside[j] = 1;
+			}
+
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				const Plane &plane = p_frustum.planes_ptr[i];
+				const uint32_t *signs = p_frustum.plane_signs_ptr[i].signs;
+				const real_t *xs = components[signs[0]].ptr() + p_block_from;
+				const real_t *ys = components[signs[1]].ptr() + p_block_from;
+				const real_t *zs = components[signs[2]].ptr() + p_block_from;
+
+				// Fixed width and branchless so the compiler can vectorize it.
+				for (uint32_t j = 0; j < BLOCK_SIZE; j++) {
+					real_t dist = plane.normal.x * xs[j] + plane.normal.y * ys[j] + plane.normal.z * zs[j] - plane.d;
+					inside[j] &= dist < 0.0;
+				}
+			}
+
+			uint32_t mask = 0;
+			for (uint32_t j = 0; j < BLOCK_SIZE; j++) {
+				mask |= uint32_t(inside[j]) << j;
+			}
+			return mask;
+		}
+	};
+
 	struct InstanceVisibilityNotifierData;
 
 	struct InstanceData {
@@ -353,6 +434,7 @@ public:
 		LocalVector<RID> dynamic_lights;
 
 		PagedArray<InstanceBounds> instance_aabbs;
+		InstanceBoundsSoA instance_bounds_soa;
 		PagedArray<InstanceData> instance_data;
 		VisibilityArray instance_visibility;
 
@@ -35,6 +35,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "renderer_canvas_cull.h"
 #include "renderer_scene_cull.h"
+#include "rendering_server_default.h"
 #include "rendering_server_globals.h"
 #include "storage/texture_storage.h"
 
@@ -630,7 +631,9 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 				ptr = ptr->filter_next_ptr;
 			}
 
+			uint64_t stage_from = RenderingServerDefault::draw_stage_begin();
 			RSG::canvas->render_canvas(p_viewport->render_target, canvas, xform, canvas_lights, canvas_directional_lights, clip_rect, p_viewport->texture_filter, p_viewport->texture_repeat, p_viewport->snap_2d_transforms_to_pixel, p_viewport->snap_2d_vertices_to_pixel, p_viewport->canvas_cull_mask, &p_viewport->render_info);
+			RenderingServerDefault::draw_stage_end(RenderingServerDefault::DRAW_STAGE_CANVAS_RENDER, stage_from);
 			if (RSG::canvas->was_sdf_used()) {
 				p_viewport->sdf_active = true;
 			}
@@ -128,9 +128,8 @@ static uint32_t _get_device_type_score(const RenderingContextDriver::Device &p_d
 
 // The command graph can automatically issue secondary command buffers and record them on background threads when they reach an arbitrary
 // size threshold. This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. However,
-// this setting is not enabled by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood.
-
-#define SECONDARY_COMMAND_BUFFERS_PER_FRAME 0
+// this is not enabled by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood. The amount
+// of secondary command buffers per frame is controlled by the "rendering/rendering_device/secondary_command_buffers/per_frame" setting.
 
 RenderingDevice *RenderingDevice::singleton = nullptr;
 
@@ -6678,7 +6677,8 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	driver->command_buffer_begin(frames[0].command_buffer);
 
 	// Create draw graph and start it initialized as well.
-	draw_graph.initialize(driver, device, &_render_pass_create_from_graph, frames.size(), main_queue_family, SECONDARY_COMMAND_BUFFERS_PER_FRAME);
+	uint32_t secondary_command_buffers_per_frame = MAX(0, int(GLOBAL_GET("rendering/rendering_device/secondary_command_buffers/per_frame")));
+	draw_graph.initialize(driver, device, &_render_pass_create_from_graph, frames.size(), main_queue_family, secondary_command_buffers_per_frame);
 	draw_graph.begin();
 
 	for (uint32_t i = 0; i < frames.size(); i++) {
@@ -35,6 +35,9 @@
 #define PRINT_RESOURCE_TRACKER_TOTAL 0
 #define PRINT_COMMAND_RECORDING 0
 
+// Draw lists with fewer bytes of instructions than this are recorded directly, as the overhead of a secondary command buffer isn't worth it.
+#define SECONDARY_COMMAND_BUFFER_MIN_INSTRUCTION_SIZE 16384
+
 RenderingDeviceGraph::RenderingDeviceGraph() {
 	driver_honors_barriers = false;
 	driver_clears_with_copy_engine = false;
@@ -902,6 +905,7 @@ void RenderingDeviceGraph::_add_draw_list_begin(FramebufferCache *p_framebuffer_
 	}
 
 	draw_instruction_list.split_cmd_buffer = p_split_cmd_buffer;
+	draw_instruction_list.secondary_compatible = true;
 
 #if defined(DEBUG_ENABLED) || defined(DEV_ENABLED)
 	draw_instruction_list.breadcrumb = p_breadcrumb;
@@ -910,10 +914,51 @@ void RenderingDeviceGraph::_add_draw_list_begin(FramebufferCache *p_framebuffer_
 
 void RenderingDeviceGraph::_run_secondary_command_buffer_task(const SecondaryCommandBuffer *p_secondary) {
 	driver->command_buffer_begin_secondary(p_secondary->command_buffer, p_secondary->render_pass, 0, p_secondary->framebuffer);
-	_run_draw_list_command(p_secondary->command_buffer, p_secondary->instruction_data.ptr(), p_secondary->instruction_data.size());
+	_run_draw_list_command(p_secondary->command_buffer, p_secondary->instruction_data, p_secondary->instruction_data_size);
 	driver->command_buffer_end(p_secondary->command_buffer);
 }
 
+void RenderingDeviceGraph::_run_secondary_command_buffers(const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, uint32_t &r_secondary_from) {
+	// Commands in the same level don't depend on each other and the barriers for the level have already been issued,
+	// so the large draw lists of the level can be recorded in parallel while the primary command buffer records the rest.
+	Frame &current_frame = frames[frame];
+	r_secondary_from = current_frame.secondary_command_buffers_used;
+
+	for (uint32_t i = 0; i < p_sorted_commands_count && current_frame.secondary_command_buffers_used < current_frame.secondary_command_buffers.size(); i++) {
+		const uint32_t command_index = p_sorted_commands[i].index;
+		const RecordedCommand *command = reinterpret_cast<const RecordedCommand *>(&command_data[command_data_offsets[command_index]]);
+		if (command->type != RecordedCommand::TYPE_DRAW_LIST) {
+			continue;
+		}
+
+		const RecordedDrawListCommand *draw_list_command = reinterpret_cast<const RecordedDrawListCommand *>(command);
+		if (!draw_list_command->secondary_compatible || draw_list_command->instruction_data_size < SECONDARY_COMMAND_BUFFER_MIN_INSTRUCTION_SIZE) {
+			continue;
+		}
+
+		RDD::RenderPassID render_pass;
+		RDD::FramebufferID framebuffer;
+		if (draw_list_command->framebuffer_cache != nullptr) {
+			_get_draw_list_render_pass_and_framebuffer(draw_list_command, render_pass, framebuffer);
+		} else {
+			render_pass = draw_list_command->render_pass;
+			framebuffer = draw_list_command->framebuffer;
+		}
+
+		if (!framebuffer || !render_pass) {
+			continue;
+		}
+
+		SecondaryCommandBuffer &secondary = current_frame.secondary_command_buffers[current_frame.secondary_command_buffers_used++];
+		secondary.instruction_data = draw_list_command->instruction_data();
+		secondary.instruction_data_size = draw_list_command->instruction_data_size;
+		secondary.command_index = command_index;
+		secondary.render_pass = render_pass;
+		secondary.framebuffer = framebuffer;
+		secondary.task = WorkerThreadPool::get_singleton()->add_template_task(this, &RenderingDeviceGraph::_run_secondary_command_buffer_task, (const SecondaryCommandBuffer *)&secondary, true, "RenderingDeviceGraphSecondary");
+	}
+}
+
 void RenderingDeviceGraph::_wait_for_secondary_command_buffer_tasks() {
 	for (uint32_t i = 0; i < frames[frame].secondary_command_buffers_used; i++) {
 		WorkerThreadPool::TaskID &task = frames[frame].secondary_command_buffers[i].task;
@@ -925,6 +970,9 @@ void RenderingDeviceGraph::_wait_for_secondary_command_buffer_tasks() {
 }
 
 void RenderingDeviceGraph::_run_render_commands(int32_t p_level, const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, RDD::CommandBufferID &r_command_buffer, CommandBufferPool &r_command_buffer_pool, int32_t &r_current_label_index, int32_t &r_current_label_level) {
+	uint32_t secondary_index = 0;
+	_run_secondary_command_buffers(p_sorted_commands, p_sorted_commands_count, secondary_index);
+
 	for (uint32_t i = 0; i < p_sorted_commands_count; i++) {
 		const uint32_t command_index = p_sorted_commands[i].index;
 		const uint32_t command_data_offset = command_data_offsets[command_index];
@@ -1013,7 +1061,19 @@ void RenderingDeviceGraph::_run_render_commands(int32_t p_level, const RecordedC
 					framebuffer = draw_list_command->framebuffer;
 				}
 
-				if (framebuffer && render_pass) {
+				Frame &current_frame = frames[frame];
+				if (secondary_index < current_frame.secondary_command_buffers_used && current_frame.secondary_command_buffers[secondary_index].command_index == command_index) {
+					// The draw list was recorded on a worker thread, it must be finished before the primary command buffer can execute it.
+					SecondaryCommandBuffer &secondary = current_frame.secondary_command_buffers[secondary_index++];
+					if (secondary.task != WorkerThreadPool::INVALID_TASK_ID) {
+						WorkerThreadPool::get_singleton()->wait_for_task_completion(secondary.task);
+						secondary.task = WorkerThreadPool::INVALID_TASK_ID;
+					}
+
+					driver->command_begin_render_pass(r_command_buffer, secondary.render_pass, secondary.framebuffer, RDD::COMMAND_BUFFER_TYPE_SECONDARY, draw_list_command->region, clear_values);
+					driver->command_buffer_execute_secondary(r_command_buffer, secondary.command_buffer);
+					driver->command_end_render_pass(r_command_buffer);
+				} else if (framebuffer && render_pass) {
 					driver->command_begin_render_pass(r_command_buffer, render_pass, framebuffer, draw_list_command->command_buffer_type, draw_list_command->region, clear_values);
 					_run_draw_list_command(r_command_buffer, draw_list_command->instruction_data(), draw_list_command->instruction_data_size);
 					driver->command_end_render_pass(r_command_buffer);
@@ -1844,12 +1904,16 @@ void RenderingDeviceGraph::add_draw_list_execute_commands(RDD::CommandBufferID p
 	DrawListExecuteCommandsInstruction *instruction = reinterpret_cast<DrawListExecuteCommandsInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListExecuteCommandsInstruction)));
 	instruction->type = DrawListInstruction::TYPE_EXECUTE_COMMANDS;
 	instruction->command_buffer = p_command_buffer;
+	draw_instruction_list.secondary_compatible = false;
 }
 
 void RenderingDeviceGraph::add_draw_list_next_subpass(RDD::CommandBufferType p_command_buffer_type) {
 	DrawListNextSubpassInstruction *instruction = reinterpret_cast<DrawListNextSubpassInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListNextSubpassInstruction)));
 	instruction->type = DrawListInstruction::TYPE_NEXT_SUBPASS;
 	instruction->command_buffer_type = p_command_buffer_type;
+
+	// A secondary command buffer can only record a single subpass.
+	draw_instruction_list.secondary_compatible = false;
 }
 
 void RenderingDeviceGraph::add_draw_list_set_blend_constants(const Color &p_color) {
@@ -1938,6 +2002,7 @@ void RenderingDeviceGraph::add_draw_list_end() {
 	command->breadcrumb = draw_instruction_list.breadcrumb;
 #endif
 	command->split_cmd_buffer = draw_instruction_list.split_cmd_buffer;
+	command->secondary_compatible = draw_instruction_list.secondary_compatible;
 	command->clear_values_count = draw_instruction_list.attachment_clear_values.size();
 	command->trackers_count = trackers_count;
 
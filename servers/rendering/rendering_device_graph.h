@@ -267,6 +267,7 @@ private:
 		uint32_t breadcrumb;
 #endif
 		bool split_cmd_buffer = false;
+		bool secondary_compatible = true;
 	};
 
 	struct RecordedCommandSort {
@@ -363,6 +364,7 @@ private:
 		uint32_t breadcrumb = 0;
 #endif
 		bool split_cmd_buffer = false;
+		bool secondary_compatible = true;
 
 		_FORCE_INLINE_ RDD::RenderPassClearValue *clear_values() {
 			return reinterpret_cast<RDD::RenderPassClearValue *>(&this[1]);
@@ -675,7 +677,9 @@ private:
 	};
 
 	struct SecondaryCommandBuffer {
-		LocalVector<uint8_t> instruction_data;
+		const uint8_t *instruction_data = nullptr;
+		uint32_t instruction_data_size = 0;
+		uint32_t command_index = 0;
 		RDD::CommandBufferID command_buffer;
 		RDD::CommandPoolID command_pool;
 		RDD::RenderPassID render_pass;
@@ -747,6 +751,7 @@ private:
 	void _add_draw_list_begin(FramebufferCache *p_framebuffer_cache, RDD::RenderPassID p_render_pass, RDD::FramebufferID p_framebuffer, Rect2i p_region, VectorView<AttachmentOperation> p_attachment_operations, VectorView<RDD::RenderPassClearValue> p_attachment_clear_values, bool p_uses_color, bool p_uses_depth, uint32_t p_breadcrumb, bool p_split_cmd_buffer);
 	void _run_secondary_command_buffer_task(const SecondaryCommandBuffer *p_secondary);
 	void _wait_for_secondary_command_buffer_tasks();
+	void _run_secondary_command_buffers(const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, uint32_t &r_secondary_from);
 	void _run_render_commands(int32_t p_level, const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, RDD::CommandBufferID &r_command_buffer, CommandBufferPool &r_command_buffer_pool, int32_t &r_current_label_index, int32_t &r_current_label_level);
 	void _run_label_command_change(RDD::CommandBufferID p_command_buffer, int32_t p_new_label_index, int32_t p_new_level, bool p_ignore_previous_value, bool p_use_label_for_empty, const RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, int32_t &r_current_label_index, int32_t &r_current_label_level);
 	void _boost_priority_for_render_commands(RecordedCommandSort *p_sorted_commands, uint32_t p_sorted_commands_count, uint32_t &r_boosted_priority);
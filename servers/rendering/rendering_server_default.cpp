@@ -42,6 +42,11 @@
 
 int RenderingServerDefault::changes = 0;
 
+bool RenderingServerDefault::draw_stage_timing = false;
+uint64_t RenderingServerDefault::draw_stage_frames = 0;
+uint64_t RenderingServerDefault::draw_stage_usec[DRAW_STAGE_MAX] = {};
+uint64_t RenderingServerDefault::draw_stage_calls[DRAW_STAGE_MAX] = {};
+
 /* FREE */
 
 void RenderingServerDefault::_free(RID p_rid) {
@@ -69,6 +74,7 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 }
 
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	MemoryTagScope tag_scope(Memory::TAG_RENDERING);
 	RSG::rasterizer->begin_frame(frame_step);
 
 	TIMESTAMP_BEGIN()
@@ -76,18 +82,35 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	uint64_t time_usec = OS::get_singleton()->get_ticks_usec();
 
 	RENDER_TIMESTAMP("Prepare Render Frame");
+	uint64_t stage_from = draw_stage_begin();
 	RSG::scene->update(); //update scenes stuff before updating instances
+	draw_stage_end(DRAW_STAGE_SCENE_UPDATE, stage_from);
 
 	frame_setup_time = double(OS::get_singleton()->get_ticks_usec() - time_usec) / 1000.0;
 
+	stage_from = draw_stage_begin();
 	RSG::particles_storage->update_particles(); //need to be done after instances are updated (colliders and particle transforms), and colliders are rendered
+	draw_stage_end(DRAW_STAGE_PARTICLES, stage_from);
 
+	stage_from = draw_stage_begin();
 	RSG::scene->render_probes();
+	draw_stage_end(DRAW_STAGE_PROBES, stage_from);
 
+	stage_from = draw_stage_begin();
 	RSG::viewport->draw_viewports(p_swap_buffers);
+	draw_stage_end(DRAW_STAGE_VIEWPORTS, stage_from);
+
+	stage_from = draw_stage_begin();
 	RSG::canvas_render->update();
+	draw_stage_end(DRAW_STAGE_CANVAS_UPDATE, stage_from);
 
+	stage_from = draw_stage_begin();
 	RSG::rasterizer->end_frame(p_swap_buffers);
+	draw_stage_end(DRAW_STAGE_END_FRAME, stage_from);
+
+	if (draw_stage_timing) {
+		draw_stage_frames++;
+	}
 
 #ifndef _3D_DISABLED
 	XRServer *xr_server = XRServer::get_singleton();
@@ -331,6 +354,33 @@ void RenderingServerDefault::sdfgi_set_debug_probe_select(const Vector3 &p_posit
 	RSG::scene->sdfgi_set_debug_probe_select(p_position, p_dir);
 }
 
+void RenderingServerDefault::set_draw_stage_timing_enabled(bool p_enabled) {
+	draw_stage_timing = p_enabled;
+	if (p_enabled) {
+		draw_stage_frames = 0;
+		for (int i = 0; i < DRAW_STAGE_MAX; i++) {
+			draw_stage_usec[i] = 0;
+			draw_stage_calls[i] = 0;
+		}
+	}
+}
+
+const char *RenderingServerDefault::get_draw_stage_name(DrawStage p_stage) {
+	static const char *names[DRAW_STAGE_MAX] = {
+		"Scene Update",
+		"Particles",
+		"Probes",
+		"Viewports",
+		"Scene Cull",
+		"Scene Render",
+		"Canvas Render",
+		"Canvas Update",
+		"End Frame",
+	};
+	ERR_FAIL_INDEX_V(p_stage, DRAW_STAGE_MAX, "");
+	return names[p_stage];
+}
+
 void RenderingServerDefault::set_print_gpu_profile(bool p_enable) {
 	RSG::utilities->capturing_timestamps = p_enable;
 	print_gpu_profile = p_enable;
@@ -380,6 +430,7 @@ void RenderingServerDefault::_thread_exit() {
 
 void RenderingServerDefault::_thread_loop() {
 	DisplayServer::get_singleton()->gl_window_make_current(DisplayServer::MAIN_WINDOW_ID); // Move GL to this thread.
+	Memory::set_current_tag(Memory::TAG_RENDERING); // Everything this thread allocates belongs to the renderer.
 
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
@@ -32,6 +32,7 @@
 #define RENDERING_SERVER_DEFAULT_H
 
 #include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
 #include "core/templates/hash_map.h"
@@ -110,6 +111,49 @@ public:
 	}
 #endif
 
+	/* DRAW STAGE TIMING */
+
+	// CPU time spent in each stage of a frame, accumulated while enabled (used by --benchmark-rendering).
+	// Nested stages are also counted in the stage that contains them.
+	enum DrawStage {
+		DRAW_STAGE_SCENE_UPDATE,
+		DRAW_STAGE_PARTICLES,
+		DRAW_STAGE_PROBES,
+		DRAW_STAGE_VIEWPORTS,
+		DRAW_STAGE_SCENE_CULL, // Nested in probes and viewports.
+		DRAW_STAGE_SCENE_RENDER, // Nested in probes and viewports.
+		DRAW_STAGE_CANVAS_RENDER, // Nested in viewports.
+		DRAW_STAGE_CANVAS_UPDATE,
+		DRAW_STAGE_END_FRAME,
+		DRAW_STAGE_MAX,
+	};
+
+private:
+	static bool draw_stage_timing;
+	static uint64_t draw_stage_frames;
+	static uint64_t draw_stage_usec[DRAW_STAGE_MAX];
+	static uint64_t draw_stage_calls[DRAW_STAGE_MAX];
+
+public:
+	_FORCE_INLINE_ static uint64_t draw_stage_begin() {
+		return draw_stage_timing ? OS::get_singleton()->get_ticks_usec() : 0;
+	}
+
+	_FORCE_INLINE_ static void draw_stage_end(DrawStage p_stage, uint64_t p_from) {
+		if (draw_stage_timing) {
+			draw_stage_usec[p_stage] += OS::get_singleton()->get_ticks_usec() - p_from;
+			draw_stage_calls[p_stage]++;
+		}
+	}
+
+	// Enabling also resets the accumulated times. Must be called while the render thread is idle.
+	static void set_draw_stage_timing_enabled(bool p_enabled);
+	static uint64_t get_draw_stage_frames() { return draw_stage_frames; }
+	static uint64_t get_draw_stage_usec(DrawStage p_stage) { return draw_stage_usec[p_stage]; }
+	// Number of times the stage ran, so callers can tell a stage that was skipped from a fast one.
+	static uint64_t get_draw_stage_calls(DrawStage p_stage) { return draw_stage_calls[p_stage]; }
+	static const char *get_draw_stage_name(DrawStage p_stage);
+
 #define WRITE_ACTION redraw_request();
 
 #ifdef DEBUG_SYNC
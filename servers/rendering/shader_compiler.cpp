@@ -1477,7 +1477,7 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
-Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+Error ShaderCompiler::_compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1585,7 +1585,47 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 	return OK;
 }
 
+Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	if (compile_mutex.try_lock()) {
+		Error err = _compile(p_mode, p_code, p_actions, p_path, r_gen_code);
+		compile_mutex.unlock();
+		return err;
+	}
+
+	// Busy on another thread, use a spare compiler instead of waiting.
+	ShaderCompiler *compiler = nullptr;
+	{
+		MutexLock lock(spare_compilers_mutex);
+		if (!spare_compilers.is_empty()) {
+			compiler = spare_compilers[spare_compilers.size() - 1];
+			spare_compilers.resize(spare_compilers.size() - 1);
+		}
+	}
+
+	if (compiler == nullptr) {
+		compiler = memnew(ShaderCompiler);
+		compiler->initialize(actions);
+	}
+
+	Error err = compiler->_compile(p_mode, p_code, p_actions, p_path, r_gen_code);
+
+	MutexLock lock(spare_compilers_mutex);
+	spare_compilers.push_back(compiler);
+	return err;
+}
+
+void ShaderCompiler::_clear_spare_compilers() {
+	MutexLock lock(spare_compilers_mutex);
+	for (ShaderCompiler *compiler : spare_compilers) {
+		memdelete(compiler);
+	}
+	spare_compilers.clear();
+}
+
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
+	// Spare compilers would still use the old actions.
+	_clear_spare_compilers();
+
 	actions = p_actions;
 
 	time_name = "TIME";
@@ -1612,3 +1652,7 @@ void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 
 ShaderCompiler::ShaderCompiler() {
 }
+
+ShaderCompiler::~ShaderCompiler() {
+	_clear_spare_compilers();
+}
@@ -31,6 +31,8 @@
 #ifndef SHADER_COMPILER_H
 #define SHADER_COMPILER_H
 
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "servers/rendering/shader_language.h"
 #include "servers/rendering_server.h"
@@ -125,13 +127,24 @@ private:
 
 	DefaultIdentifierActions actions;
 
+	// The parser and the state above can only be used by one thread at a time,
+	// other threads compiling at the same time borrow one of the spare compilers.
+	Mutex compile_mutex;
+	Mutex spare_compilers_mutex;
+	LocalVector<ShaderCompiler *> spare_compilers;
+
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
+	Error _compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
+	void _clear_spare_compilers();
+
 public:
+	// Thread-safe, several shaders can be compiled at the same time.
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
 	void initialize(DefaultIdentifierActions p_actions);
 	ShaderCompiler();
+	~ShaderCompiler();
 };
 
 #endif // SHADER_COMPILER_H
@@ -724,21 +724,24 @@ ShaderLanguage::Token ShaderLanguage::_get_token() {
 						CASE_MAX,
 					} lut_case = CASE_ALL;
 
-					static bool suffix_lut[CASE_MAX][127];
-
-					if (!is_const_suffix_lut_initialized) {
-						is_const_suffix_lut_initialized = true;
-
-						for (int i = 0; i < 127; i++) {
-							char t = char(i);
-
-							suffix_lut[CASE_ALL][i] = t == '.' || t == 'x' || t == 'e' || t == 'f' || t == 'u' || t == '-' || t == '+';
-							suffix_lut[CASE_HEXA_PERIOD][i] = t == 'e' || t == 'f' || t == 'u';
-							suffix_lut[CASE_EXPONENT][i] = t == 'f' || t == '-' || t == '+';
-							suffix_lut[CASE_SIGN_AFTER_EXPONENT][i] = t == 'f';
-							suffix_lut[CASE_NONE][i] = false;
+					// Shaders can be compiled from several threads at once, so the table is built by a thread-safe static initializer.
+					struct SuffixLUT {
+						bool cases[CASE_MAX][127];
+
+						SuffixLUT() {
+							for (int i = 0; i < 127; i++) {
+								char t = char(i);
+
+								cases[CASE_ALL][i] = t == '.' || t == 'x' || t == 'e' || t == 'f' || t == 'u' || t == '-' || t == '+';
+								cases[CASE_HEXA_PERIOD][i] = t == 'e' || t == 'f' || t == 'u';
+								cases[CASE_EXPONENT][i] = t == 'f' || t == '-' || t == '+';
+								cases[CASE_SIGN_AFTER_EXPONENT][i] = t == 'f';
+								cases[CASE_NONE][i] = false;
+							}
 						}
-					}
+					};
+					static const SuffixLUT suffix_lut_data;
+					const auto &suffix_lut = suffix_lut_data.cases;
 
 					String str;
 					int i = 0;
@@ -3514,6 +3517,8 @@ const ShaderLanguage::BuiltinFuncDef ShaderLanguage::builtin_func_defs[] = {
 };
 
 HashSet<StringName> global_func_set;
+// Guards the creation and destruction of global_func_set, as ShaderLanguage instances can be created on several threads.
+static Mutex global_func_set_mutex;
 
 const ShaderLanguage::BuiltinFuncOutArgs ShaderLanguage::builtin_func_out_args[] = {
 	{ "modf", { 1, -1 } },
@@ -3544,8 +3549,6 @@ const ShaderLanguage::BuiltinEntry ShaderLanguage::frag_only_func_defs[] = {
 	{ nullptr }
 };
 
-bool ShaderLanguage::is_const_suffix_lut_initialized = false;
-
 bool ShaderLanguage::_validate_function_call(BlockNode *p_block, const FunctionInfo &p_function_info, OperatorNode *p_func, DataType *r_ret_type, StringName *r_ret_type_str, bool *r_is_custom_function) {
 	ERR_FAIL_COND_V(p_func->op != OP_CALL && p_func->op != OP_CONSTRUCT, false);
 
@@ -11578,16 +11581,19 @@ ShaderLanguage::ShaderLanguage() {
 	nodes = nullptr;
 	completion_class = TAG_GLOBAL;
 
-	if (instance_counter.get() == 0) {
-		int idx = 0;
-		while (builtin_func_defs[idx].name) {
-			if (builtin_func_defs[idx].tag == SubClassTag::TAG_GLOBAL) {
-				global_func_set.insert(builtin_func_defs[idx].name);
+	{
+		MutexLock lock(global_func_set_mutex);
+		if (instance_counter.get() == 0) {
+			int idx = 0;
+			while (builtin_func_defs[idx].name) {
+				if (builtin_func_defs[idx].tag == SubClassTag::TAG_GLOBAL) {
+					global_func_set.insert(builtin_func_defs[idx].name);
+				}
+				idx++;
 			}
-			idx++;
 		}
+		instance_counter.increment();
 	}
-	instance_counter.increment();
 
 #ifdef DEBUG_ENABLED
 	warnings_check_map.insert(ShaderWarning::UNUSED_CONSTANT, &used_constants);
@@ -11602,6 +11608,8 @@ ShaderLanguage::ShaderLanguage() {
 
 ShaderLanguage::~ShaderLanguage() {
 	clear();
+
+	MutexLock lock(global_func_set_mutex);
 	instance_counter.decrement();
 	if (instance_counter.get() == 0) {
 		global_func_set.clear();
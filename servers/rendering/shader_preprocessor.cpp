@@ -1253,21 +1253,56 @@ void ShaderPreprocessor::clear_state() {
 	state = nullptr;
 }
 
+Mutex ShaderPreprocessor::include_cache_mutex;
+HashMap<uint64_t, ShaderPreprocessor::CachedInclude> ShaderPreprocessor::include_cache;
+
+bool ShaderPreprocessor::_get_cached_include(uint64_t p_hash, const String &p_code, String &r_stripped) {
+	MutexLock lock(include_cache_mutex);
+	HashMap<uint64_t, CachedInclude>::ConstIterator E = include_cache.find(p_hash);
+	if (!E || E->value.code != p_code) {
+		return false;
+	}
+
+	r_stripped = E->value.stripped;
+	return true;
+}
+
+void ShaderPreprocessor::_cache_include(uint64_t p_hash, const String &p_code, const String &p_stripped) {
+	MutexLock lock(include_cache_mutex);
+	if (include_cache.size() >= 1024) {
+		// Edited includes leave their old versions behind, start over rather than growing forever.
+		include_cache.clear();
+	}
+
+	CachedInclude &cached = include_cache[p_hash];
+	cached.code = p_code;
+	cached.stripped = p_stripped;
+}
+
 Error ShaderPreprocessor::preprocess(State *p_state, const String &p_code, String &r_result) {
 	output.clear();
 
 	state = p_state;
 
-	CommentRemover remover(p_code);
-	String stripped = remover.strip();
-	String error = remover.get_error();
-	if (!error.is_empty()) {
-		set_error(error, remover.get_error_line());
-		return FAILED;
+	uint64_t code_hash = p_code.hash64();
+
+	String stripped;
+	const bool is_include = state->include_depth > 0;
+	if (!is_include || !_get_cached_include(code_hash, p_code, stripped)) {
+		CommentRemover remover(p_code);
+		stripped = remover.strip();
+		String error = remover.get_error();
+		if (!error.is_empty()) {
+			set_error(error, remover.get_error_line());
+			return FAILED;
+		}
+
+		if (is_include) {
+			_cache_include(code_hash, p_code, stripped);
+		}
 	}
 
 	// Track code hashes to prevent cyclic include.
-	uint64_t code_hash = p_code.hash64();
 	state->cyclic_include_hashes.push_back(code_hash);
 
 	Tokenizer p_tokenizer(stripped);
@@ -31,7 +31,9 @@
 #ifndef SHADER_PREPROCESSOR_H
 #define SHADER_PREPROCESSOR_H
 
+#include "core/os/mutex.h"
 #include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/list.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
@@ -172,6 +174,19 @@ private:
 	LocalVector<char32_t> output;
 	State *state = nullptr;
 
+	// Includes are shared by many shaders, which can be preprocessed on several threads at once.
+	// Their code without comments is cached by content, as it doesn't depend on the including shader.
+	struct CachedInclude {
+		String code;
+		String stripped;
+	};
+
+	static Mutex include_cache_mutex;
+	static HashMap<uint64_t, CachedInclude> include_cache;
+
+	static bool _get_cached_include(uint64_t p_hash, const String &p_code, String &r_stripped);
+	static void _cache_include(uint64_t p_hash, const String &p_code, const String &p_stripped);
+
 private:
 	static bool is_char_word(char32_t p_char);
 	static bool is_char_space(char32_t p_char);
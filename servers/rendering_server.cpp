@@ -3600,6 +3600,7 @@ void RenderingServer::init() {
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/use_zstd_compression", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/strip_debug", false);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/strip_debug.release", true);
+	GLOBAL_DEF("rendering/shader_compiler/shader_cache/usage_manifest", true);
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/reflections/sky_reflections/roughness_layers", PROPERTY_HINT_RANGE, "1,32,1"), 8); // Assumes a 256x256 cubemap
 	GLOBAL_DEF_RST("rendering/reflections/sky_reflections/texture_array_reflections", true);
@@ -3657,6 +3658,9 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/occlusion_culling/occlusion_rays_per_thread", PROPERTY_HINT_RANGE, "1,2048,1,or_greater"), 512);
 
+	GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "rendering/mesh_lod/lod_change/hysteresis", PROPERTY_HINT_RANGE, "0,0.5,0.01"), 0.1);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/mesh_lod/lod_change/max_changes_per_frame", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"), 0);
+
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/environment/glow/upscale_mode", PROPERTY_HINT_ENUM, "Linear (Fast),Bicubic (Slow)"), 1);
 	GLOBAL_DEF("rendering/environment/glow/upscale_mode.mobile", 0);
 
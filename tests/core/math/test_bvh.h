@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*  test_bvh.h                                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_BVH_H
+#define TEST_BVH_H
+
+#include "core/math/bvh.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBVH {
+
+struct Item {
+	int id = 0;
+};
+
+template <typename T>
+class PairTestFunction {
+public:
+	static bool user_pair_check(const T *p_a, const T *p_b) {
+		return true;
+	}
+};
+
+template <typename T>
+class CullTestFunction {
+public:
+	static bool user_cull_check(const T *p_a, const T *p_b) {
+		return true;
+	}
+};
+
+enum {
+	TREE_STATIC = 0,
+	TREE_DYNAMIC = 1,
+	TREE_FLAG_STATIC = 1 << TREE_STATIC,
+	TREE_FLAG_DYNAMIC = 1 << TREE_DYNAMIC,
+};
+
+typedef BVH_Manager<Item, 2, true, 32, PairTestFunction<Item>, CullTestFunction<Item>> TestBVHManager;
+
+static void *pair_callback(void *p_self, uint32_t, Item *, int, uint32_t, Item *, int) {
+	(*static_cast<int *>(p_self))++;
+	return nullptr;
+}
+
+static void unpair_callback(void *p_self, uint32_t, Item *, int, uint32_t, Item *, int, void *) {
+	(*static_cast<int *>(p_self))--;
+}
+
+static int count_in(TestBVHManager &p_bvh, const AABB &p_aabb, uint32_t p_tree_mask) {
+	Item *results[512];
+	return p_bvh.cull_aabb(p_aabb, results, 512, nullptr, p_tree_mask);
+}
+
+TEST_CASE("[BVH] Lazy trees") {
+	TestBVHManager bvh;
+	int pairs = 0;
+	bvh.set_pair_callback(pair_callback, &pairs);
+	bvh.set_unpair_callback(unpair_callback, &pairs);
+	bvh.params_set_lazy_trees(TREE_FLAG_STATIC, 16);
+
+	// A grid of static items, like a streamed in chunk of level geometry.
+	LocalVector<Item> items;
+	items.resize(400);
+	LocalVector<BVHHandle> handles;
+	for (int i = 0; i < 20; i++) {
+		for (int j = 0; j < 20; j++) {
+			Item &item = items[i * 20 + j];
+			item.id = i * 20 + j;
+			handles.push_back(bvh.create(&item, true, TREE_STATIC, TREE_FLAG_DYNAMIC, AABB(Vector3(i, 0, j), Vector3(0.5, 0.5, 0.5))));
+		}
+	}
+	const AABB corner = AABB(Vector3(-0.25, -1, -0.25), Vector3(5, 2, 5));
+
+	SUBCASE("Items in a lazy tree can be culled right away and after optimizing") {
+		CHECK(count_in(bvh, corner, TREE_FLAG_STATIC) == 25);
+		CHECK(count_in(bvh, corner, TREE_FLAG_DYNAMIC) == 0);
+
+		// Optimizing the 400 new items takes 25 updates with a budget of 16.
+		for (int i = 0; i < 30; i++) {
+			bvh.update();
+			CHECK(count_in(bvh, corner, TREE_FLAG_STATIC) == 25);
+		}
+
+		for (int i = 0; i < 5; i++) {
+			bvh.erase(handles[i]);
+		}
+		bvh.update();
+		CHECK(count_in(bvh, corner, TREE_FLAG_STATIC) == 20);
+		handles.clear();
+	}
+
+	SUBCASE("Items added to a lazy tree are paired on the next update") {
+		bvh.update();
+		CHECK(pairs == 0);
+
+		Item dynamic_item;
+		BVHHandle dynamic = bvh.create(&dynamic_item, true, TREE_DYNAMIC, TREE_FLAG_STATIC | TREE_FLAG_DYNAMIC, AABB(Vector3(0, 0, 0), Vector3(0.2, 0.2, 0.2)));
+		CHECK_MESSAGE(pairs == 1, "Items added to other trees are paired immediately.");
+
+		Item static_item;
+		BVHHandle added = bvh.create(&static_item, true, TREE_STATIC, TREE_FLAG_DYNAMIC, AABB(Vector3(0.1, 0, 0.1), Vector3(0.2, 0.2, 0.2)));
+		CHECK(pairs == 1);
+		bvh.update();
+		CHECK(pairs == 2);
+
+		bvh.move(dynamic, AABB(Vector3(50, 0, 50), Vector3(0.2, 0.2, 0.2)));
+		bvh.update();
+		CHECK(pairs == 0);
+
+		bvh.erase(added);
+		bvh.erase(dynamic);
+	}
+
+	SUBCASE("Items can move between a lazy tree and a regular one") {
+		bvh.set_tree(handles[0], TREE_DYNAMIC, TREE_FLAG_STATIC | TREE_FLAG_DYNAMIC);
+		bvh.update();
+		CHECK(count_in(bvh, corner, TREE_FLAG_STATIC) == 24);
+		CHECK(count_in(bvh, corner, TREE_FLAG_DYNAMIC) == 1);
+
+		bvh.move(handles[0], AABB(Vector3(0.8, 0, 0), Vector3(0.5, 0.5, 0.5)));
+		bvh.update();
+		CHECK_MESSAGE(pairs == 1, "The item now in the dynamic tree pairs with the static neighbor it overlaps.");
+
+		bvh.set_tree(handles[0], TREE_STATIC, TREE_FLAG_DYNAMIC);
+		bvh.update();
+		CHECK(count_in(bvh, corner, TREE_FLAG_STATIC) == 25);
+		CHECK(count_in(bvh, corner, TREE_FLAG_DYNAMIC) == 0);
+	}
+
+	for (const BVHHandle &handle : handles) {
+		bvh.erase(handle);
+	}
+}
+
+} // namespace TestBVH
+
+#endif // TEST_BVH_H
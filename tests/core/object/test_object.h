@@ -111,6 +111,8 @@ public:
 		return 0;
 	}
 	Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) override {
+		// Like script languages, report the method as missing so the object falls back to native methods.
+		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
 		return Variant();
 	}
 	void notification(int p_notification, bool p_reversed = false) override {
@@ -534,6 +536,168 @@ TEST_CASE("[Object] Notification order") { // GH-52325
 	memdelete(test_notification_object);
 }
 
+class SignalReceiver : public Object {
+public:
+	LocalVector<int> *log = nullptr;
+	int id = 0;
+	Object *emitter = nullptr;
+	Callable to_disconnect;
+
+	void on_signal() {
+		log->push_back(id);
+		if (to_disconnect.is_valid()) {
+			emitter->disconnect("tick", to_disconnect);
+			to_disconnect = Callable();
+		}
+	}
+};
+
+TEST_CASE("[Object] Signal emission order") {
+	Object emitter;
+	emitter.add_user_signal(MethodInfo("tick"));
+
+	LocalVector<int> log;
+	LocalVector<SignalReceiver *> receivers;
+	LocalVector<Callable> callables;
+	for (int i = 0; i < 90; i++) {
+		SignalReceiver *receiver = memnew(SignalReceiver);
+		receiver->log = &log;
+		receiver->id = i;
+		receiver->emitter = &emitter;
+		receivers.push_back(receiver);
+		callables.push_back(callable_mp(receiver, &SignalReceiver::on_signal));
+		emitter.connect("tick", callables[i]);
+	}
+
+	emitter.emit_signal("tick");
+	CHECK(log.size() == 90);
+	for (int i = 0; i < 90; i++) {
+		CHECK(log[i] == i);
+	}
+
+	// Disconnecting most of the connections keeps the order of the others.
+	for (int i = 0; i < 90; i++) {
+		if (i % 3 != 0) {
+			emitter.disconnect("tick", callables[i]);
+		}
+	}
+	emitter.connect("tick", callables[1]);
+
+	log.clear();
+	emitter.emit_signal("tick");
+	CHECK(log.size() == 31);
+	for (int i = 0; i < 30; i++) {
+		CHECK(log[i] == i * 3);
+	}
+	CHECK(log[30] == 1);
+
+	// Disconnecting during emission only takes effect for the next one.
+	receivers[0]->to_disconnect = callables[3];
+	log.clear();
+	emitter.emit_signal("tick");
+	CHECK(log.size() == 31);
+	CHECK(log[1] == 3);
+
+	log.clear();
+	emitter.emit_signal("tick");
+	CHECK(log.size() == 30);
+	CHECK(log[1] == 6);
+
+	// One-shot connections are only called once.
+	emitter.connect("tick", callables[2], Object::CONNECT_ONE_SHOT);
+	log.clear();
+	emitter.emit_signal("tick");
+	CHECK(log.size() == 31);
+	CHECK(log[30] == 2);
+	log.clear();
+	emitter.emit_signal("tick");
+	CHECK(log.size() == 30);
+
+	// Deleted targets are skipped.
+	memdelete(receivers[6]);
+	receivers[6] = nullptr;
+	log.clear();
+	emitter.emit_signal("tick");
+	CHECK(log.size() == 29);
+	CHECK(log[1] == 9);
+
+	for (SignalReceiver *receiver : receivers) {
+		if (receiver) {
+			memdelete(receiver);
+		}
+	}
+	CHECK_FALSE(emitter.has_connections("tick"));
+}
+
+TEST_CASE("[Object] Cached method calls") {
+	Object object;
+
+	SUBCASE("Exact argument types") {
+		object.call("set_message_translation", false);
+		CHECK_FALSE(bool(object.call("can_translate_messages")));
+		object.call("set_message_translation", true);
+		CHECK(bool(object.call("can_translate_messages")));
+
+		CHECK(bool(object.call("has_method", StringName("has_method"))));
+		CHECK_FALSE(bool(object.call("has_method", StringName("no_such_method"))));
+	}
+
+	SUBCASE("Converted argument types") {
+		object.call("set_message_translation", 0);
+		CHECK_FALSE(bool(object.call("can_translate_messages")));
+
+		CHECK(bool(object.call("has_method", "has_method")));
+		CHECK_FALSE(bool(object.call("has_method", "no_such_method")));
+	}
+
+	SUBCASE("Wrong argument count") {
+		Callable::CallError call_error;
+		object.callp("can_translate_messages", nullptr, 0, call_error);
+		CHECK_EQ(call_error.error, Callable::CallError::CALL_OK);
+
+		const Variant arg = true;
+		const Variant *args[1] = { &arg };
+		object.callp("can_translate_messages", args, 1, call_error);
+		CHECK_EQ(call_error.error, Callable::CallError::CALL_ERROR_TOO_MANY_ARGUMENTS);
+	}
+
+	SUBCASE("Through signals") {
+		Object emitter;
+		emitter.add_user_signal(MethodInfo("some_signal", PropertyInfo(Variant::BOOL, "block")));
+		emitter.connect("some_signal", Callable(&object, "set_block_signals"));
+
+		emitter.emit_signal("some_signal", true);
+		CHECK(object.is_blocking_signals());
+		emitter.emit_signal("some_signal", false);
+		CHECK_FALSE(object.is_blocking_signals());
+	}
+
+	SUBCASE("Through a script instance") {
+		// The script instance doesn't have the method, the native one must be called and succeed.
+		object.set_script_instance(memnew(_MockScriptInstance));
+
+		Callable::CallError call_error;
+		const Variant arg = true;
+		const Variant *args[1] = { &arg };
+		object.callp("set_message_translation", args, 1, call_error);
+		CHECK_EQ(call_error.error, Callable::CallError::CALL_OK);
+		CHECK(object.can_translate_messages());
+
+		Object emitter;
+		emitter.add_user_signal(MethodInfo("some_signal", PropertyInfo(Variant::BOOL, "block")));
+		emitter.connect("some_signal", Callable(&object, "set_block_signals"));
+		CHECK_EQ(emitter.emit_signal("some_signal", true), OK);
+		CHECK(object.is_blocking_signals());
+	}
+
+	SUBCASE("Missing method") {
+		Callable::CallError call_error;
+		object.callp("no_such_method", nullptr, 0, call_error);
+		CHECK_EQ(call_error.error, Callable::CallError::CALL_ERROR_INVALID_METHOD);
+		CHECK(ClassDB::get_method_cached(object.get_class_name(), "no_such_method") == nullptr);
+	}
+}
+
 TEST_CASE("[Object] Destruction at the end of the call chain is safe") {
 	Object *object = memnew(Object);
 	ObjectID obj_id = object->get_instance_id();
@@ -173,6 +173,37 @@ TEST_CASE("[OS] Processor count and memory information") {
 #endif // DEBUG_ENABLED
 }
 
+#ifdef MEMORY_TAGS_ENABLED
+TEST_CASE("[OS] Static memory usage by tag") {
+	const uint64_t physics_before = Memory::get_tag_mem_usage(Memory::TAG_PHYSICS);
+	const uint64_t audio_before = Memory::get_tag_mem_usage(Memory::TAG_AUDIO);
+
+	void *explicit_tag = memalloc_tagged(1000, Memory::TAG_PHYSICS);
+	void *scoped_tag = nullptr;
+	{
+		MemoryTagScope tag_scope(Memory::TAG_AUDIO);
+		scoped_tag = memalloc(2000);
+	}
+	CHECK(Memory::get_current_tag() == Memory::TAG_GENERAL);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_PHYSICS) == physics_before + 1000);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == audio_before + 2000);
+
+	// Reallocations stay with the tag of the original allocation.
+	scoped_tag = memrealloc(scoped_tag, 3000);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == audio_before + 3000);
+	CHECK(Memory::get_tag_mem_max_usage(Memory::TAG_AUDIO) >= audio_before + 3000);
+
+	Dictionary usage = OS::get_singleton()->get_static_memory_usage_by_tag();
+	CHECK(usage.size() == Memory::TAG_MAX);
+	CHECK(uint64_t(Dictionary(usage["Audio"])["usage"]) == audio_before + 3000);
+
+	memfree(explicit_tag);
+	memfree(scoped_tag);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_PHYSICS) == physics_before);
+	CHECK(Memory::get_tag_mem_usage(Memory::TAG_AUDIO) == audio_before);
+}
+#endif // MEMORY_TAGS_ENABLED
+
 TEST_CASE("[OS] Execute") {
 #ifdef WINDOWS_ENABLED
 	List<String> arguments;
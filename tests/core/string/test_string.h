@@ -264,6 +264,23 @@ TEST_CASE("[String] Concatenation") {
 	CHECK(s == "Have a Nice Day");
 }
 
+TEST_CASE("[String] Concatenation and construction from ranges") {
+	const char32_t *source = U"Have a Nice Day";
+
+	String s(StrRange(source, 4));
+	CHECK(s == "Have");
+
+	s += StrRange(source + 4, 7);
+	s += StrRange(source, 0);
+	CHECK(s == "Have a Nice");
+
+	// Appending part of itself.
+	s += StrRange(s.ptr() + 4, 2);
+	CHECK(s == "Have a Nice a");
+
+	CHECK(String(StrRange("Day", 2)) == "Da");
+}
+
 TEST_CASE("[String] Testing size and length of string") {
 	// todo: expand this test to do more tests on size() as it is complicated under the hood.
 	CHECK(String("Mellon").size() == 7);
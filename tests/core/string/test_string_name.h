@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName from_cstring = "interned_name";
+	const StringName from_string = String("interned_name");
+
+	CHECK(from_cstring == from_string);
+	CHECK(from_cstring.data_unique_pointer() == from_string.data_unique_pointer());
+	CHECK(StringName::search("interned_name") == from_cstring);
+	CHECK(StringName::search("never_interned_name") == StringName());
+}
+
+TEST_CASE("[StringName] Interning from ranges") {
+	const StringName from_cstring = "range_name";
+	const char32_t *source = U"range_name_suffix";
+
+	const StringName from_range = StringName(StrRange(source, 10));
+	CHECK(from_range == from_cstring);
+	CHECK(from_range.data_unique_pointer() == from_cstring.data_unique_pointer());
+
+	const StringName new_from_range = StringName(StrRange(source, 12));
+	CHECK(String(new_from_range) == "range_name_s");
+	CHECK(StringName::search(U"range_name_s") == new_from_range);
+
+	CHECK(StringName(StrRange(source, 0)) == StringName());
+}
+
+struct ConcurrentInterning {
+	static constexpr int NAME_COUNT = 512;
+	static constexpr int ITERATIONS = 64;
+
+	Vector<String> names;
+	Vector<StringName> expected;
+	SafeNumeric<uint32_t> mismatches;
+
+	ConcurrentInterning() {
+		for (int i = 0; i < NAME_COUNT; i++) {
+			names.push_back("concurrent_name_" + itos(i));
+			expected.push_back(names[i]);
+		}
+	}
+
+	static void thread_func(void *p_userdata) {
+		ConcurrentInterning *self = static_cast<ConcurrentInterning *>(p_userdata);
+		for (int i = 0; i < ITERATIONS; i++) {
+			for (int j = 0; j < NAME_COUNT; j++) {
+				// Create and release the name, so lookups, inserts and removals all race with each other.
+				StringName name = self->names[j];
+				if (name != self->expected[j]) {
+					self->mismatches.increment();
+				}
+				StringName transient = self->names[j] + "_transient";
+			}
+		}
+	}
+
+	void run(int p_thread_count) {
+		Vector<Thread *> threads;
+		for (int i = 0; i < p_thread_count; i++) {
+			Thread *thread = memnew(Thread);
+			thread->start(&ConcurrentInterning::thread_func, this);
+			threads.push_back(thread);
+		}
+		for (Thread *thread : threads) {
+			thread->wait_to_finish();
+			memdelete(thread);
+		}
+	}
+
+	void check() {
+		CHECK_MESSAGE(mismatches.get() == 0, "Every thread should get the same interned entry for a given name.");
+		for (int i = 0; i < NAME_COUNT; i++) {
+			CHECK(StringName::search(names[i] + "_transient") == StringName());
+		}
+	}
+};
+
+TEST_CASE("[StringName] Concurrent interning") {
+	ConcurrentInterning state;
+	state.run(4);
+	state.check();
+}
+
+TEST_CASE("[StringName][Benchmark] Concurrent interning from 1 to 32 threads" * doctest::skip()) {
+	ConcurrentInterning state;
+	for (int thread_count = 1; thread_count <= 32; thread_count *= 2) {
+		uint64_t from = OS::get_singleton()->get_ticks_usec();
+		state.run(thread_count);
+		print_line(vformat("StringName concurrent interning: %d threads, %d usec.", thread_count, OS::get_singleton()->get_ticks_usec() - from));
+	}
+	state.check();
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
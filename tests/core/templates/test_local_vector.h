@@ -244,6 +244,80 @@ TEST_CASE("[LocalVector] Size / Resize / Reserve.") {
 	CHECK(vector.size() == 4);
 	CHECK(vector.get_capacity() >= 4);
 }
+
+TEST_CASE("[LocalVector] Arena allocator.") {
+	Memory::ArenaTagStats stats_before[8];
+	uint32_t tags_before = Memory::get_arena_tag_stats(stats_before, 8);
+
+	{
+		ArenaScope scope("TestLocalVector");
+		ArenaLocalVector<int> vector;
+		for (int i = 0; i < 10000; i++) {
+			vector.push_back(i);
+		}
+		CHECK(vector.size() == 10000);
+		CHECK(vector[0] == 0);
+		CHECK(vector[9999] == 9999);
+
+		{
+			// Memory from a nested scope is released when it ends.
+			ArenaScope nested_scope("TestLocalVectorNested");
+			ArenaLocalVector<int> nested;
+			for (int i = 0; i < 100; i++) {
+				nested.push_back(7);
+			}
+			CHECK(nested[99] == 7);
+		}
+
+		vector.push_back(10000);
+		CHECK(vector[10000] == 10000);
+		CHECK(vector[5000] == 5000);
+	}
+
+	Memory::ArenaTagStats stats[8];
+	uint32_t tags = Memory::get_arena_tag_stats(stats, 8);
+	CHECK(tags >= tags_before);
+	bool found = false;
+	for (uint32_t i = 0; i < MIN(tags, 8u); i++) {
+		if (strcmp(stats[i].tag, "TestLocalVector") == 0) {
+			found = true;
+			CHECK(stats[i].bytes >= 10001 * sizeof(int));
+			CHECK(stats[i].calls > 0);
+		}
+	}
+	CHECK(found);
+
+	{
+		// Growing a vector of an outer scope inside a nested one must not place its data in memory
+		// that the nested scope releases.
+		ArenaScope scope("TestLocalVectorOuter");
+		ArenaLocalVector<int> vector;
+		vector.push_back(0);
+		{
+			ArenaScope nested_scope("TestLocalVectorGrow");
+			for (int i = 1; i < 1000; i++) {
+				vector.push_back(i);
+			}
+		}
+
+		ArenaLocalVector<int> other;
+		for (int i = 0; i < 1000; i++) {
+			other.push_back(-1);
+		}
+		bool intact = true;
+		for (int i = 0; i < 1000; i++) {
+			intact = intact && vector[i] == i;
+		}
+		CHECK(intact);
+		CHECK(other[999] == -1);
+	}
+
+	// Outside of a scope, arena allocations fall back to the heap.
+	ArenaLocalVector<int> heap_vector;
+	heap_vector.push_back(1);
+	heap_vector.push_back(2);
+	CHECK(heap_vector[1] == 2);
+}
 } // namespace TestLocalVector
 
 #endif // TEST_LOCAL_VECTOR_H
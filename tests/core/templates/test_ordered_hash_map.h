@@ -0,0 +1,230 @@
+/**************************************************************************/
+/*  test_ordered_hash_map.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ORDERED_HASH_MAP_H
+#define TEST_ORDERED_HASH_MAP_H
+
+#include "core/templates/ordered_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOrderedHashMap {
+
+TEST_CASE("[OrderedHashMap] Insert element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[OrderedHashMap] Overwrite element") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[OrderedHashMap] Erase via element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[OrderedHashMap] Erase via key") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	CHECK(map.erase(42));
+	CHECK(!map.erase(42));
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[OrderedHashMap] Insertion order") {
+	OrderedHashMap<int, int> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(9 - i, i);
+	}
+
+	int expected = 9;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected);
+		expected--;
+	}
+	CHECK(expected == -1);
+}
+
+TEST_CASE("[OrderedHashMap] Insertion order is kept when erasing") {
+	OrderedHashMap<int, int> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(i, i);
+	}
+	map.erase(0);
+	map.erase(5);
+	map.erase(9);
+	map.insert(5, 5);
+
+	const int expected[] = { 1, 2, 3, 4, 6, 7, 8, 5 };
+	int i = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected[i]);
+		i++;
+	}
+	CHECK(i == 8);
+
+	// Backwards iteration skips the erased elements too.
+	OrderedHashMap<int, int>::Iterator it = map.last();
+	for (i = 7; i >= 0; i--) {
+		CHECK(it->key == expected[i]);
+		--it;
+	}
+	CHECK(!it);
+
+	for (i = 0; i < 8; i++) {
+		CHECK(map.get_by_index(i).key == expected[i]);
+	}
+}
+
+TEST_CASE("[OrderedHashMap] Pointers stay valid") {
+	OrderedHashMap<int, int> map;
+	map[0] = 42;
+	int *value = map.getptr(0);
+	const int *key = &map.find(0)->key;
+
+	for (int i = 1; i < 1000; i++) {
+		map.insert(i, i);
+		if (i % 3 == 0) {
+			map.erase(i - 1); // Leaves holes, which are compacted when growing.
+		}
+	}
+	CHECK(value == map.getptr(0));
+	CHECK(*value == 42);
+	CHECK(*key == 0);
+
+	// Reads a reference while inserting.
+	map[5000] = map[0];
+	CHECK(map[5000] == 42);
+}
+
+TEST_CASE("[OrderedHashMap] Many elements") {
+	OrderedHashMap<int, int> map;
+	const int elem_max = 100000;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(i, i);
+	}
+	for (int i = 0; i < elem_max; i += 2) {
+		map.erase(i);
+	}
+	CHECK(map.size() == elem_max / 2);
+
+	int expected = 1;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected);
+		CHECK(E.value == expected);
+		expected += 2;
+	}
+	for (int i = 0; i < elem_max; i++) {
+		CHECK(map.has(i) == bool(i % 2));
+	}
+}
+
+TEST_CASE("[OrderedHashMap] Precomputed hash") {
+	OrderedHashMap<String, int> map;
+	const String key = "key";
+	const uint32_t hash = HashMapHasherDefault::hash(key);
+	map.insert(key, 1, hash);
+
+	CHECK(map.has(key));
+	CHECK(map.has(key, hash));
+	CHECK(*map.getptr(key, hash) == 1);
+	CHECK(map.erase(key, hash));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[OrderedHashMap] Clear") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 84);
+	map.insert(0, 84);
+
+	map.clear();
+	CHECK(!map.has(42));
+	CHECK(map.size() == 0);
+	CHECK(map.is_empty());
+	CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("[OrderedHashMap] Copy") {
+	OrderedHashMap<int, String> map;
+	map.insert(123, "123");
+	map.insert(0, "0");
+	map.insert(42, "42");
+	map.erase(0);
+
+	OrderedHashMap<int, String> copy = map;
+	CHECK(copy.size() == 2);
+	CHECK(copy.get_by_index(0).key == 123);
+	CHECK(copy.get_by_index(1).key == 42);
+	CHECK(copy[42] == "42");
+
+	copy.insert(7, "7");
+	CHECK(!map.has(7));
+}
+
+TEST_CASE("[OrderedHashMap] Sort") {
+	OrderedHashMap<Variant, int, VariantHasher, VariantComparator> map;
+	map.insert(3, 0);
+	map.insert(1, 0);
+	map.insert(2, 0);
+	map.insert(0, 0);
+	map.erase(0);
+
+	map.sort();
+
+	int expected = 1;
+	for (const KeyValue<Variant, int> &E : map) {
+		CHECK(int(E.key) == expected);
+		expected++;
+	}
+	CHECK(map.has(2));
+}
+
+} // namespace TestOrderedHashMap
+
+#endif // TEST_ORDERED_HASH_MAP_H
@@ -31,7 +31,9 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +98,91 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+TEST_CASE("[RID_Owner] Make and free") {
+	RID_Owner<int> owner;
+
+	RID rid_a = owner.make_rid(1);
+	RID rid_b = owner.make_rid(2);
+	CHECK(owner.get_rid_count() == 2);
+	CHECK(owner.owns(rid_a));
+	CHECK(*owner.get_or_null(rid_b) == 2);
+
+	owner.free(rid_a);
+	CHECK(owner.get_rid_count() == 1);
+	CHECK_FALSE(owner.owns(rid_a));
+	CHECK(owner.get_or_null(rid_a) == nullptr);
+
+	// The slot is reused, but the old RID stays invalid.
+	RID rid_c = owner.make_rid(3);
+	CHECK(rid_c.get_local_index() == rid_a.get_local_index());
+	CHECK(rid_c != rid_a);
+	CHECK_FALSE(owner.owns(rid_a));
+	CHECK(*owner.get_or_null(rid_c) == 3);
+
+	owner.free(rid_b);
+	owner.free(rid_c);
+	CHECK(owner.get_rid_count() == 0);
+}
+
+TEST_CASE("[RID_Owner] Make many RIDs at once") {
+	RID_Owner<int, true> owner(64);
+	RID rids[100];
+	owner.make_rids(rids, 100, 5);
+	CHECK(owner.get_rid_count() == 100);
+
+	bool all_valid = true;
+	HashSet<RID> unique;
+	for (const RID &rid : rids) {
+		all_valid &= owner.owns(rid) && *owner.get_or_null(rid) == 5;
+		unique.insert(rid);
+	}
+	CHECK(all_valid);
+	CHECK(unique.size() == 100);
+
+	for (const RID &rid : rids) {
+		owner.free(rid);
+	}
+	CHECK(owner.get_rid_count() == 0);
+}
+
+static RID_Owner<uint32_t, true> *thread_owner = nullptr;
+static SafeNumeric<uint32_t> thread_errors;
+
+static void static_rid_thread_test(void *p_arg, uint32_t p_index) {
+	RID rids[32];
+	for (int iteration = 0; iteration < 64; iteration++) {
+		if (iteration % 2) {
+			thread_owner->make_rids(rids, 32, p_index);
+		} else {
+			for (RID &rid : rids) {
+				rid = thread_owner->make_rid(p_index);
+			}
+		}
+		for (const RID &rid : rids) {
+			uint32_t *value = thread_owner->get_or_null(rid);
+			if (value == nullptr || *value != p_index) {
+				thread_errors.increment();
+			}
+		}
+		for (const RID &rid : rids) {
+			thread_owner->free(rid);
+		}
+	}
+}
+
+TEST_CASE("[RID_Owner] Make and free from several threads") {
+	RID_Owner<uint32_t, true> owner(256);
+	thread_owner = &owner;
+	thread_errors.set(0);
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_rid_thread_test, nullptr, 64, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(thread_errors.get() == 0);
+	CHECK(owner.get_rid_count() == 0);
+	thread_owner = nullptr;
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
@@ -0,0 +1,280 @@
+/**************************************************************************/
+/*  test_swiss_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SWISS_HASH_MAP_H
+#define TEST_SWISS_HASH_MAP_H
+
+#include "core/os/os.h"
+#include "core/templates/a_hash_map.h"
+#include "core/templates/swiss_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSwissHashMap {
+
+TEST_CASE("[SwissHashMap] Insert element") {
+	SwissHashMap<int, int> map;
+	SwissHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[SwissHashMap] Overwrite element") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[SwissHashMap] Erase via element and key") {
+	SwissHashMap<int, int> map;
+	SwissHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.insert(43, 86);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+
+	CHECK(map.erase(43));
+	CHECK(!map.erase(43));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[SwissHashMap] Iteration") {
+	SwissHashMap<int, int> map;
+
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(0, 12934));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		idx++;
+	}
+
+	idx--;
+	for (SwissHashMap<int, int>::Iterator it = map.last(); it; --it) {
+		CHECK(expected[idx] == Pair<int, int>(it->key, it->value));
+		idx--;
+	}
+}
+
+TEST_CASE("[SwissHashMap] Replace key") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(0, 12934);
+	CHECK(map.replace_key(0, 1));
+	CHECK(map.has(1));
+	CHECK(!map.has(0));
+	CHECK(map[1] == 12934);
+}
+
+TEST_CASE("[SwissHashMap] Clear and get") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	CHECK(map.get(123) == 12385);
+	CHECK(*map.getptr(42) == 84);
+	CHECK(map.getptr(7) == nullptr);
+
+	map.clear();
+	CHECK(!map.has(42));
+	CHECK(map.size() == 0);
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[SwissHashMap] Insert, iterate and remove many elements") {
+	const int elem_max = 12345;
+	SwissHashMap<int, int> map;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(i, i);
+	}
+
+	// Insertion order should have been kept.
+	int idx = 0;
+	for (auto &K : map) {
+		CHECK(idx == K.key);
+		CHECK(idx == K.value);
+		idx++;
+	}
+
+	Vector<int> elems_still_valid;
+	for (int i = 0; i < elem_max; i++) {
+		if ((i % 5) == 0) {
+			map.erase(i);
+		} else {
+			elems_still_valid.push_back(i);
+		}
+	}
+
+	CHECK(elems_still_valid.size() == map.size());
+	for (int i = 0; i < elems_still_valid.size(); i++) {
+		CHECK(map.has(elems_still_valid[i]));
+		CHECK(map[elems_still_valid[i]] == elems_still_valid[i]);
+	}
+	for (int i = 0; i < elem_max; i += 5) {
+		CHECK(!map.has(i));
+	}
+
+	// Erasing and inserting repeatedly must reuse deleted slots instead of growing forever.
+	const uint32_t capacity = map.get_capacity();
+	for (int i = 0; i < elem_max * 4; i++) {
+		map.insert(elem_max + i, i);
+		map.erase(elem_max + i);
+	}
+	CHECK(map.get_capacity() == capacity);
+	CHECK(elems_still_valid.size() == map.size());
+}
+
+TEST_CASE("[SwissHashMap] Insert, iterate and remove many strings") {
+	const int elem_max = 432;
+	SwissHashMap<String, String> map;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(itos(i), itos(i));
+	}
+
+	int idx = 0;
+	for (auto &K : map) {
+		CHECK(itos(idx) == K.key);
+		CHECK(itos(idx) == K.value);
+		idx++;
+	}
+
+	for (int i = 0; i < elem_max; i++) {
+		if ((i % 5) == 0) {
+			map.erase(itos(i));
+		}
+	}
+	for (int i = 0; i < elem_max; i++) {
+		CHECK(map.has(itos(i)) == ((i % 5) != 0));
+	}
+}
+
+TEST_CASE("[SwissHashMap] Heterogeneous lookup") {
+	SwissHashMap<StringName, int> map;
+	map.insert(StringName("position"), 1);
+	map.insert(StringName("rotation"), 2);
+
+	CHECK(map.has_as(String("position")));
+	CHECK(!map.has_as(String("scale")));
+	CHECK(*map.getptr_as(String("rotation")) == 2);
+	CHECK(map.find_as(String("rotation"))->value == 2);
+}
+
+TEST_CASE("[SwissHashMap] Copy constructor and operator =") {
+	SwissHashMap<int, int> map0;
+	const int count = 5;
+	for (int i = 0; i < count; i++) {
+		map0.insert(i, i);
+	}
+	SwissHashMap<int, int> map1(map0);
+	CHECK(map0.size() == map1.size());
+	for (int i = 0; i < count; i++) {
+		CHECK(map1[i] == i);
+	}
+
+	SwissHashMap<int, int> map2;
+	map2.insert(100, 100);
+	map2 = map1;
+	CHECK(!map2.has(100));
+	CHECK(map2.size() == (uint32_t)count);
+	map2.insert(6, 6);
+	CHECK(!map1.has(6));
+
+	HashMap<int, int> hash_map;
+	hash_map.insert(7, 70);
+	SwissHashMap<int, int> map3(hash_map);
+	CHECK(map3[7] == 70);
+}
+
+template <typename M>
+static uint64_t _benchmark_map(const Vector<StringName> &p_keys, const Vector<StringName> &p_missing_keys, int p_rounds) {
+	const uint64_t from = OS::get_singleton()->get_ticks_usec();
+	int64_t sum = 0;
+	for (int round = 0; round < p_rounds; round++) {
+		M map;
+		for (int i = 0; i < p_keys.size(); i++) {
+			map.insert(p_keys[i], i);
+		}
+		for (int pass = 0; pass < 8; pass++) {
+			for (int i = 0; i < p_keys.size(); i++) {
+				sum += *map.getptr(p_keys[i]);
+			}
+			for (int i = 0; i < p_missing_keys.size(); i++) {
+				sum += map.has(p_missing_keys[i]) ? 1 : 0;
+			}
+		}
+		for (const KeyValue<StringName, int> &E : map) {
+			sum += E.value;
+		}
+		for (int i = 0; i < p_keys.size(); i += 2) {
+			map.erase(p_keys[i]);
+		}
+	}
+	CHECK(sum > 0);
+	return OS::get_singleton()->get_ticks_usec() - from;
+}
+
+// Skipped by default, run with `--test --no-skip --test-case="*Benchmark*"`.
+TEST_CASE("[SwissHashMap][Benchmark] Compare against HashMap and AHashMap" * doctest::skip()) {
+	for (int size : { 16, 256, 4096, 65536 }) {
+		Vector<StringName> keys;
+		Vector<StringName> missing_keys;
+		for (int i = 0; i < size; i++) {
+			keys.push_back(StringName("key_" + itos(i)));
+			missing_keys.push_back(StringName("missing_" + itos(i)));
+		}
+		const int rounds = MAX(1, 262144 / size);
+
+		const uint64_t hash_map_usec = _benchmark_map<HashMap<StringName, int>>(keys, missing_keys, rounds);
+		const uint64_t a_hash_map_usec = _benchmark_map<AHashMap<StringName, int>>(keys, missing_keys, rounds);
+		const uint64_t swiss_hash_map_usec = _benchmark_map<SwissHashMap<StringName, int>>(keys, missing_keys, rounds);
+		print_line(vformat("%d elements, %d rounds: HashMap %d usec, AHashMap %d usec, SwissHashMap %d usec.", size, rounds, hash_map_usec, a_hash_map_usec, swiss_hash_map_usec));
+	}
+}
+
+} // namespace TestSwissHashMap
+
+#endif // TEST_SWISS_HASH_MAP_H
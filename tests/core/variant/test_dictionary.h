@@ -557,6 +557,71 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Values keep their address when inserting") {
+	Dictionary d;
+	d["first"] = "value";
+	const Variant *value = d.getptr("first");
+
+	for (int i = 0; i < 100; i++) {
+		d[i] = i;
+	}
+	CHECK_EQ(d.getptr("first"), value);
+
+	// Reads a reference while inserting.
+	d["copy"] = d["first"];
+	CHECK_EQ(d["copy"], Variant("value"));
+}
+
+TEST_CASE("[Dictionary] Order is kept when erasing") {
+	Dictionary d;
+	for (int i = 0; i < 100; i++) {
+		d[i] = i;
+	}
+	for (int i = 0; i < 100; i += 2) {
+		d.erase(i);
+	}
+	d[0] = 0;
+
+	CHECK_EQ(d.size(), 51);
+	for (int i = 0; i < 50; i++) {
+		CHECK_EQ(d.get_key_at_index(i), Variant(i * 2 + 1));
+	}
+	CHECK_EQ(d.get_key_at_index(50), Variant(0));
+	CHECK_EQ(d.get_key_at_index(51), Variant());
+
+	const Variant *key = d.next(nullptr);
+	CHECK_EQ(*key, Variant(1));
+	key = d.next(key);
+	CHECK_EQ(*key, Variant(3));
+
+	d.sort();
+	CHECK_EQ(d.get_key_at_index(0), Variant(0));
+	CHECK_EQ(d.get_key_at_index(1), Variant(1));
+	CHECK_EQ(d.get_key_at_index(50), Variant(99));
+}
+
+TEST_CASE("[Dictionary] Typed keys") {
+	TypedDictionary<StringName, int> typed;
+	typed[StringName("a")] = 1;
+	typed[StringName("b")] = 2;
+
+	// Hashes stay consistent when the keys move to an untyped dictionary.
+	Dictionary untyped = typed.duplicate();
+	Dictionary other;
+	other.assign(typed);
+	CHECK(other.has("a"));
+	CHECK(other.has(StringName("b")));
+	CHECK_EQ(untyped, other);
+
+	TypedDictionary<Vector2i, int> vectors;
+	vectors[Vector2i(1, 2)] = 3;
+	Dictionary untyped_vectors;
+	untyped_vectors.assign(vectors);
+	CHECK_EQ(untyped_vectors[Vector2i(1, 2)], Variant(3));
+	CHECK(vectors.has(Vector2i(1, 2)));
+	CHECK(!vectors.has(Vector2i(2, 1)));
+}
+
 TEST_CASE("[Dictionary] Typed copying") {
 	TypedDictionary<int, int> d1;
 	d1[0] = 1;
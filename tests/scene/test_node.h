@@ -387,6 +387,90 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(child_by_path, node1_1);
 	}
 
+	SUBCASE("Nodes accessed repeatedly via their node path should follow tree changes") {
+		Window *root = SceneTree::get_singleton()->get_root();
+		node1->set_name("Node1");
+		node1_1->set_name("NestedNode");
+		const NodePath path = NodePath("Node1/NestedNode");
+
+		CHECK_EQ(root->get_node_or_null(path), node1_1);
+		CHECK_EQ(root->get_node_or_null(path), node1_1);
+
+		node1_1->set_name("RenamedNode");
+		CHECK_EQ(root->get_node_or_null(path), nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/RenamedNode")), node1_1);
+
+		node1->remove_child(node1_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/RenamedNode")), nullptr);
+
+		node1_1->set_name("NestedNode");
+		node1->add_child(node1_1);
+		CHECK_EQ(root->get_node_or_null(path), node1_1);
+
+		node1->remove_child(node1_1);
+		node2->add_child(node1_1);
+		CHECK_EQ(root->get_node_or_null(path), nullptr);
+		CHECK_EQ(node1->get_node_or_null(NodePath("../" + String(node2->get_name()) + "/NestedNode")), node1_1);
+	}
+
+	SUBCASE("Paths going above a node without a parent should resolve once it gets one") {
+		Window *root = SceneTree::get_singleton()->get_root();
+		node1->set_name("Node1");
+		Node *detached = memnew(Node);
+		Node *detached_child = memnew(Node);
+		detached->add_child(detached_child);
+		const NodePath path = NodePath("../../Node1");
+
+		CHECK_EQ(detached_child->get_node_or_null(path), nullptr);
+		CHECK_EQ(detached_child->get_node_or_null(path), nullptr);
+		CHECK_EQ(detached->get_node_or_null(NodePath("../Node1")), nullptr);
+
+		root->add_child(detached);
+		CHECK_EQ(detached_child->get_node_or_null(path), node1);
+		CHECK_EQ(detached->get_node_or_null(NodePath("../Node1")), node1);
+
+		memdelete(detached);
+	}
+
+	SUBCASE("Nodes accessed repeatedly via their unique name should follow owner changes") {
+		Node *holder = memnew(Node);
+		holder->set_name("Holder");
+		node1->add_child(holder);
+		node1_1->set_name("Unique");
+		node1->remove_child(node1_1);
+		holder->add_child(node1_1);
+
+		holder->set_owner(node1);
+		node1_1->set_owner(node1);
+		node1_1->set_unique_name_in_owner(true);
+		const NodePath path = NodePath("Holder/%Unique");
+
+		CHECK_EQ(node1->get_node_or_null(path), node1_1);
+		CHECK_EQ(node1->get_node_or_null(path), node1_1);
+
+		// Holder finds unique names through its owner.
+		holder->set_owner(nullptr);
+		CHECK_EQ(node1->get_node_or_null(path), nullptr);
+
+		holder->set_owner(node1);
+		CHECK_EQ(node1->get_node_or_null(path), node1_1);
+
+		node1_1->set_unique_name_in_owner(false);
+		CHECK_EQ(node1->get_node_or_null(path), nullptr);
+
+		// Unrelated changes elsewhere in the tree don't affect the result.
+		node1_1->set_unique_name_in_owner(true);
+		CHECK_EQ(node1->get_node_or_null(path), node1_1);
+		Node *unrelated = memnew(Node);
+		node2->add_child(unrelated);
+		CHECK_EQ(node1->get_node_or_null(path), node1_1);
+		memdelete(unrelated);
+
+		holder->remove_child(node1_1);
+		node1->add_child(node1_1);
+		memdelete(holder);
+	}
+
 	SUBCASE("Nodes should be accessible via their groups") {
 		List<Node *> nodes;
 		SceneTree::get_singleton()->get_nodes_in_group("nodes", &nodes);
@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  test_renderer_canvas_cull.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RENDERER_CANVAS_CULL_H
+#define TEST_RENDERER_CANVAS_CULL_H
+
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererCanvasCull {
+
+struct CanvasCullTest {
+	RendererCanvasCull *canvas_cull = RSG::canvas;
+	RID canvas;
+	RID parent;
+	RID child;
+
+	CanvasCullTest() {
+		canvas = canvas_cull->canvas_allocate();
+		canvas_cull->canvas_initialize(canvas);
+		parent = _create_item(canvas, Rect2(1000, 1000, 10, 10));
+		child = _create_item(parent, Rect2(1020, 1020, 10, 10));
+	}
+
+	~CanvasCullTest() {
+		canvas_cull->free(child);
+		canvas_cull->free(parent);
+		canvas_cull->free(canvas);
+	}
+
+	RID _create_item(RID p_parent, const Rect2 &p_rect) {
+		RID item = canvas_cull->canvas_item_allocate();
+		canvas_cull->canvas_item_initialize(item);
+		canvas_cull->canvas_item_set_parent(item, p_parent);
+		canvas_cull->canvas_item_add_rect(item, p_rect, Color(1, 1, 1), false);
+		return item;
+	}
+
+	RendererCanvasCull::Item *get_item(RID p_item) {
+		return canvas_cull->canvas_item_owner.get_or_null(p_item);
+	}
+
+	void render(const Transform2D &p_transform = Transform2D()) {
+		RendererCanvasCull::Canvas *canvas_data = canvas_cull->canvas_owner.get_or_null(canvas);
+		canvas_cull->render_canvas(RID(), canvas_data, p_transform, nullptr, nullptr, Rect2(0, 0, 100, 100), RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xFFFFFFFF);
+	}
+
+	// Whether the last render walked into the subtree of the parent instead of skipping it.
+	bool child_visited() {
+		return get_item(child)->bounds_pass == get_item(parent)->bounds_pass;
+	}
+};
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Off-screen subtree bounds") {
+	CanvasCullTest test;
+
+	SUBCASE("Unchanged off-screen subtrees are skipped") {
+		test.render();
+		CHECK(test.child_visited());
+		CHECK(test.get_item(test.parent)->bounds_valid);
+		CHECK(test.get_item(test.parent)->bounds_rect.is_equal_approx(Rect2(1000, 1000, 30, 30)));
+
+		test.render();
+		CHECK_FALSE(test.child_visited());
+
+		// The bounds are local to the item, so moving the camera keeps them.
+		test.render(Transform2D(0.0, Vector2(-5, -5)));
+		CHECK_FALSE(test.child_visited());
+	}
+
+	SUBCASE("Subtrees are visited again when they enter the screen") {
+		test.render();
+		test.render(Transform2D(0.0, Vector2(-1000, -1000)));
+		CHECK(test.child_visited());
+	}
+
+	SUBCASE("Changes in the subtree invalidate the bounds") {
+		test.render();
+		test.canvas_cull->canvas_item_add_rect(test.child, Rect2(10, 10, 10, 10), Color(1, 1, 1), false);
+		CHECK(test.get_item(test.parent)->bounds_dirty);
+
+		test.render();
+		CHECK(test.child_visited());
+		CHECK(test.get_item(test.parent)->bounds_rect.is_equal_approx(Rect2(10, 10, 1020, 1020)));
+
+		test.canvas_cull->canvas_item_set_transform(test.child, Transform2D(0.0, Vector2(-1010, -1010)));
+		test.render();
+		CHECK(test.child_visited());
+		CHECK(test.get_item(test.parent)->bounds_rect.is_equal_approx(Rect2(-1000, -1000, 2010, 2010)));
+	}
+
+	SUBCASE("Subtrees with transparent items are not cached") {
+		test.canvas_cull->canvas_item_set_modulate(test.child, Color(1, 1, 1, 0));
+		test.render();
+		CHECK_FALSE(test.get_item(test.parent)->bounds_valid);
+
+		test.render();
+		CHECK(test.child_visited());
+	}
+}
+
+} // namespace TestRendererCanvasCull
+
+#endif // TEST_RENDERER_CANVAS_CULL_H